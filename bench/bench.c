@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * @file    bench.c
+ * @brief   common helpers for the benchmark programs of libcoocvt
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include benchmark helpers (first) */
+#include "bench.h"
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : bench_ns
+ *  DESCRIPTION : wall-clock time in nanoseconds
+ *  INPUT       : none
+ *  OUTPUT      : monotonic time in ns
+ ******************************************************************************/
+double bench_ns(void)
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return( 1.0e9 * (double)ts.tv_sec + (double)ts.tv_nsec );
+} // end bench_ns
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : bench_ticks
+ *  DESCRIPTION : CPU time stamp counter, or nanoseconds where not available
+ *  INPUT       : none
+ *  OUTPUT      : ticks
+ ******************************************************************************/
+uint64_t bench_ticks(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return( __builtin_ia32_rdtsc() );
+#else
+    return( (uint64_t)bench_ns() );
+#endif
+} // end bench_ticks
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : bench_rand
+ *  DESCRIPTION : uniform random number in [0, 1), xorshift64* generator
+ *  INPUT       : pointer "state" to generator state (non-zero)
+ *  OUTPUT      : random number
+ ******************************************************************************/
+double bench_rand(uint64_t* state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return( (double)((*state * 2685821657736338717ull) >> 11) * 0x1.0p-53 );
+} // end bench_rand
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : bench_draw
+ *  DESCRIPTION : draw random number from distribution, truncated to [0, max)
+ *  INPUT       : - pointer "state" to generator state
+ *                - distribution "dist" of type bench_dist_t
+ *                - upper bound "max"
+ *  OUTPUT      : random number
+ ******************************************************************************/
+double bench_draw(
+    uint64_t*          state,
+    const bench_dist_t dist,
+    const double       max
+    )
+{
+    for (int k = 0; k < 1000; k++)
+    {
+        const double u = bench_rand( state );
+        const double x = (dist.kind == 'r')
+                       ? dist.par * sqrt( -2.0 * log( 1.0 - u ) )
+                       : dist.par * u;
+        if ( x < max ) return( x );
+    } // end for
+    return( 0.0 );
+} // end bench_draw
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : bench_parse_dist
+ *  DESCRIPTION : parse distribution from string "u:<max>" or "r:<sigma>"
+ *  INPUT       : - pointer "dist" of type bench_dist_t
+ *                - input string "str"
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int bench_parse_dist(
+    bench_dist_t* dist,
+    const char*   str
+    )
+{
+    if ( ((str[0] != 'u') && (str[0] != 'r')) || (str[1] != ':') ) return 1;
+    dist->kind = str[0];
+    dist->par  = atof( str + 2 );
+    return( (dist->par > 0.0) ? 0 : 1 );
+} // end bench_parse_dist
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : bench_catalog
+ *  DESCRIPTION : generate synthetic catalog of Keplerian elements
+ *  INPUT       : - pointer "obj" to array of type body_t
+ *                - number of objects "dim"
+ *                - distributions "de", "di" of eccentricity and inclination
+ *                - random "seed" (non-zero)
+ *  OUTPUT      : none
+ ******************************************************************************/
+void bench_catalog(
+    body_t             obj[],
+    const uint32_t     dim,
+    const bench_dist_t de,
+    const bench_dist_t di,
+    uint64_t           seed
+    )
+{
+    memset( obj, 0, (size_t)dim * sizeof(body_t) );
+    obj[0].mass = 1.0;
+    for (uint32_t i = 1; i < dim; i++)
+    {
+        obj[i].mass    = 1.0e-10 * pow( 1.0e7, bench_rand( &seed ) );
+        obj[i].hel.sma = 0.5 * pow( 100.0, bench_rand( &seed ) );
+        obj[i].hel.ecc = bench_draw( &seed, de, 1.0 );
+        obj[i].hel.inc = bench_draw( &seed, di, M_PI );
+        obj[i].hel.aph = 2.0 * M_PI * bench_rand( &seed );
+        obj[i].hel.lan = 2.0 * M_PI * bench_rand( &seed );
+        obj[i].hel.man = 2.0 * M_PI * bench_rand( &seed );
+    } // end for
+} // end bench_catalog
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : bench_evict
+ *  DESCRIPTION : evict data caches by streaming through a large buffer
+ *  INPUT       : - pointer "buf" to scratch buffer
+ *                - "size" of buffer in bytes
+ *  OUTPUT      : checksum, keeps the compiler from dropping the loop
+ ******************************************************************************/
+unsigned bench_evict(
+    unsigned char* buf,
+    const size_t   size
+    )
+{
+    unsigned chk = 0;
+    for (size_t k = 0; k < size; k += 64)
+    {
+        buf[k] += 1;
+        chk    += buf[k];
+    } // end for
+    return( chk );
+} // end bench_evict
+
+/******************************************************************************/
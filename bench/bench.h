@@ -0,0 +1,159 @@
+/***************************************************************************//**
+ * @file    bench.h
+ * @brief   common helpers for the benchmark programs of libcoocvt
+ * @details timers, random numbers and synthetic catalogs;
+ * include this header before any other header
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_BENCH__H
+#define COO_BENCH__H
+
+/* clock_gettime() in strict C99 mode */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+/******************************************************************************/
+
+/*** include prerequisite headers ***/
+
+/* include standard headers */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* include library header */
+#include "libcoocvt.h"
+
+/******************************************************************************/
+
+/*** define pre-processor constants ***/
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief random distribution for synthetic catalogs
+ * @details 'u' = uniform in [0, par), 'r' = Rayleigh with sigma = par,
+ * truncated to [0, max)
+ */
+typedef struct
+{
+    char   kind; ///< 'u' (uniform) or 'r' (Rayleigh)
+    double par;  ///< upper bound (uniform) or sigma (Rayleigh)
+} bench_dist_t;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+/*!
+ * @brief wall-clock time in nanoseconds
+ * @return monotonic time in ns
+ */
+double bench_ns(void);
+
+
+/*!
+ * @brief CPU time stamp counter, or nanoseconds where not available
+ * @return ticks
+ */
+uint64_t bench_ticks(void);
+
+
+/*!
+ * @brief uniform random number in [0, 1), xorshift64* generator
+ * @param[in,out] state generator state, must not be zero
+ * @return random number
+ */
+double bench_rand(uint64_t* state);
+
+
+/*!
+ * @brief draw random number from distribution, truncated to [0, max)
+ * @param[in,out] state generator state
+ * @param[in] dist distribution of type #bench_dist_t
+ * @param[in] max upper bound of result
+ * @return random number
+ */
+double bench_draw(
+    uint64_t*          state,
+    const bench_dist_t dist,
+    const double       max
+);
+
+
+/*!
+ * @brief parse distribution from string "u:<max>" or "r:<sigma>"
+ * @param[out] dist distribution of type #bench_dist_t
+ * @param[in] str input string
+ * @return 0 for success, 1 for error
+ */
+int bench_parse_dist(
+    bench_dist_t* dist,
+    const char*   str
+);
+
+
+/*!
+ * @brief generate synthetic catalog of Keplerian elements
+ * @details object 0 is the central body with mass 1, semi-major axes are
+ * log-uniform in [0.5, 50] AU, angles aph, lan, man uniform in [0, 2 pi)
+ * @param[out] obj array of type #body_t with \a dim entries
+ * @param[in] dim number of objects
+ * @param[in] de distribution of eccentricities, truncated to [0, 1)
+ * @param[in] di distribution of inclinations (radians), truncated to [0, pi)
+ * @param[in] seed random seed (non-zero)
+ * @return none
+ */
+void bench_catalog(
+    body_t             obj[],
+    const uint32_t     dim,
+    const bench_dist_t de,
+    const bench_dist_t di,
+    uint64_t           seed
+);
+
+
+/*!
+ * @brief evict data caches by streaming through a large buffer
+ * @param[in,out] buf scratch buffer
+ * @param[in] size size of \a buf in bytes, should exceed the last level cache
+ * @return checksum, to keep the compiler from dropping the loop
+ */
+unsigned bench_evict(
+    unsigned char* buf,
+    const size_t   size
+);
+
+/******************************************************************************/
+
+#endif  /* COO_BENCH__H */
@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * @file    coobench.c
+ * @brief   throughput benchmark for all conversion modes of libcoocvt
+ * @details reports ns/body and bodies/s for every CVT_MODE_e and for
+ *          coo_kesolver(), with cold and warm caches
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include benchmark helpers (first) */
+#include "bench.h"
+
+/* include module headers */
+#include "kepler.h"
+
+/******************************************************************************/
+
+/*** internal constants ***/
+
+/* names of conversion modes, indexed by CVT_MODE_e */
+static const char* const mode_name[CVT_TOTAL_NUMBER] = {
+    [CVT_NONE]        = "NONE",
+    [CVT_BCO2HCO]     = "BCO2HCO",
+    [CVT_HCO2BCO]     = "HCO2BCO",
+    [CVT_HCO2HEL]     = "HCO2HEL",
+    [CVT_HEL2HCO]     = "HEL2HCO",
+    [CVT_HEL2HCO_POS] = "HEL2HCO_POS",
+};
+
+/******************************************************************************/
+
+/* print usage information */
+static void usage(const char* prog)
+{
+    fprintf(
+        stderr,
+        "usage: %s [-n N] [-e DIST] [-i DIST] [-r REPS] [-c MB] [-s SEED]\n"
+        "  -n N     number of bodies (default 100000)\n"
+        "  -e DIST  eccentricity distribution (default u:0.3)\n"
+        "  -i DIST  inclination distribution in degrees (default r:5)\n"
+        "  -r REPS  repetitions, minimum time is reported (default 5)\n"
+        "  -c MB    size of cache eviction buffer (default 128)\n"
+        "  -s SEED  random seed (default 42)\n"
+        "  DIST = u:<max> (uniform) or r:<sigma> (Rayleigh)\n",
+        prog
+    );
+} // end usage
+
+/******************************************************************************/
+
+/* print one result line */
+static void report(
+    const char*  name,
+    const double cold,
+    const double warm,
+    const double num
+    )
+{
+    printf(
+        "%-12s %14.2f %16.4e %14.2f %16.4e\n",
+        name, cold / num, 1.0e9 * num / cold, warm / num, 1.0e9 * num / warm
+    );
+} // end report
+
+/******************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    uint32_t     dim   = 100000;
+    int          reps  = 5;
+    size_t       evict = 128;
+    uint64_t     seed  = 42;
+    bench_dist_t de    = { 'u', 0.3 };
+    bench_dist_t di    = { 'r', 5.0 };
+
+    /* parse command line */
+    for (int k = 1; k < argc; k++)
+    {
+        if ( (argv[k][0] != '-') || (k + 1 >= argc) )
+        {
+            usage( argv[0] );
+            return 1;
+        } // end if
+        const char* arg = argv[++k];
+        int         err = 0;
+        switch ( argv[k - 1][1] )
+        {
+            case 'n': dim   = (uint32_t)strtoul( arg, NULL, 10 );  break;
+            case 'r': reps  = atoi( arg );                         break;
+            case 'c': evict = (size_t)strtoul( arg, NULL, 10 );    break;
+            case 's': seed  = strtoull( arg, NULL, 10 );           break;
+            case 'e': err   = bench_parse_dist( &de, arg );        break;
+            case 'i': err   = bench_parse_dist( &di, arg );        break;
+            default : err   = 1;                                   break;
+        } // end switch
+        if ( err || (dim < 2) || (reps < 1) || (seed == 0) )
+        {
+            usage( argv[0] );
+            return 1;
+        } // end if
+    } // end for
+
+    /* allocate catalog and eviction buffer */
+    body_t*        obj = malloc( (size_t)dim * sizeof(body_t) );
+    double*        ea  = malloc( (size_t)dim * sizeof(double) );
+    unsigned char* buf = calloc( evict << 20, 1 );
+    if ( (obj == NULL) || (ea == NULL) || (buf == NULL) )
+    {
+        fprintf( stderr, "%s: Error = out of memory\n", argv[0] );
+        return 1;
+    } // end if
+
+    /* inclination distribution given in degrees */
+    di.par *= M_PI / 180.0;
+    bench_catalog( obj, dim, de, di, seed );
+
+    /* prepare valid input for all modes */
+    (void)coocvt( obj, dim, 0, CVT_HEL2HCO );
+    (void)coocvt( obj, dim, 0, CVT_HCO2BCO );
+
+    printf(
+        "# libcoocvt v%d.%02d benchmark: N = %u, ecc = %c:%g, inc = %c:%g deg, "
+        "reps = %d\n",
+        coo_get_major_version(), coo_get_minor_version(),
+        dim, de.kind, de.par, di.kind, di.par * 180.0 / M_PI, reps
+    );
+    printf(
+        "# %-10s %14s %16s %14s %16s\n",
+        "mode", "cold ns/body", "cold bodies/s", "warm ns/body", "warm bodies/s"
+    );
+
+    unsigned chk = 0;
+
+    /* all conversion modes */
+    for (int mode = CVT_NONE + 1; mode < CVT_TOTAL_NUMBER; mode++)
+    {
+        double cold = INFINITY, warm = INFINITY;
+
+        for (int r = 0; r < reps; r++)
+        {
+            chk += bench_evict( buf, evict << 20 );
+            const double t0 = bench_ns();
+            (void)coocvt( obj, dim, 0, (CVT_MODE_e)mode );
+            cold = fmin( cold, bench_ns() - t0 );
+        } // end for
+
+        for (int r = 0; r < reps; r++)
+        {
+            const double t0 = bench_ns();
+            (void)coocvt( obj, dim, 0, (CVT_MODE_e)mode );
+            warm = fmin( warm, bench_ns() - t0 );
+        } // end for
+
+        report( mode_name[mode], cold, warm, (double)dim );
+    } // end for
+
+    /* Kepler Equation solver */
+    {
+        double cold = INFINITY, warm = INFINITY;
+
+        for (int r = 0; r < 2 * reps; r++)
+        {
+            const int is_cold = (r < reps);
+            if ( is_cold ) chk += bench_evict( buf, evict << 20 );
+            const double t0 = bench_ns();
+            for (uint32_t i = 1; i < dim; i++)
+            {
+                ea[i] = coo_kesolver( obj[i].hel.ecc, obj[i].hel.man );
+            } // end for
+            const double dt = bench_ns() - t0;
+            if ( is_cold ) cold = fmin( cold, dt );
+            else           warm = fmin( warm, dt );
+        } // end for
+
+        report( "KESOLVER", cold, warm, (double)(dim - 1) );
+    } // end block
+
+    /* keep results alive */
+    if ( chk == 1u ) printf( "# %g\n", ea[1] );
+
+    free( buf );
+    free( ea );
+    free( obj );
+    return 0;
+} // end main
+
+/******************************************************************************/
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * @file    cookepler.c
+ * @brief   accuracy and cost map of the Kepler Equation solver of libcoocvt
+ * @details evaluates coo_kesolver() on a grid in the (e, M) plane and writes
+ *          the residual |M - E + e sin E| and the cost in CPU ticks per call
+ *          as CSV; the logarithmic grid resolves the corner e -> 1, M -> 0
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include benchmark helpers (first) */
+#include "bench.h"
+#include <float.h>
+
+/* include module headers */
+#include "kepler.h"
+
+/******************************************************************************/
+
+/* print usage information */
+static void usage(const char* prog)
+{
+    fprintf(
+        stderr,
+        "usage: %s [-g lin|log] [-e NE] [-m NM] [-d DEC] [-r REPS]\n"
+        "  -g GRID  lin: e in [0, 1), M in [0, pi] linear (default)\n"
+        "           log: 1 - e and M logarithmic in [10^-DEC, 1] and\n"
+        "                [10^-DEC, pi], resolves the corner e -> 1, M -> 0\n"
+        "  -e NE    number of eccentricity grid points (default 200)\n"
+        "  -m NM    number of mean anomaly grid points (default 200)\n"
+        "  -d DEC   decades covered by the logarithmic grid (default 8)\n"
+        "  -r REPS  calls per grid point, minimum cost is reported "
+        "(default 16)\n"
+        "  output: CSV with columns ecc, ma, ea, res, res_eps, ticks\n"
+        "  res = |M - E + e sin E| in long double, res_eps = res / (eps E)\n",
+        prog
+    );
+} // end usage
+
+/******************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    char   grid = 'l';
+    int    ne   = 200;
+    int    nm   = 200;
+    int    reps = 16;
+    double dec  = 8.0;
+
+    /* parse command line */
+    for (int k = 1; k < argc; k++)
+    {
+        if ( (argv[k][0] != '-') || (k + 1 >= argc) )
+        {
+            usage( argv[0] );
+            return 1;
+        } // end if
+        const char* arg = argv[++k];
+        int         err = 0;
+        switch ( argv[k - 1][1] )
+        {
+            case 'g': grid = (arg[1] == 'o') ? 'o' : arg[0];  break;
+            case 'e': ne   = atoi( arg );                     break;
+            case 'm': nm   = atoi( arg );                     break;
+            case 'd': dec  = atof( arg );                     break;
+            case 'r': reps = atoi( arg );                     break;
+            default : err  = 1;                               break;
+        } // end switch
+        if ( err || ((grid != 'l') && (grid != 'o')) || (ne < 2) || (nm < 2)
+            || (reps < 1) || (dec <= 0.0) )
+        {
+            usage( argv[0] );
+            return 1;
+        } // end if
+    } // end for
+
+    /* calibrate overhead of tick counter */
+    uint64_t overhead = UINT64_MAX;
+    for (int r = 0; r < 1000; r++)
+    {
+        const uint64_t t0 = bench_ticks();
+        const uint64_t dt = bench_ticks() - t0;
+        if ( dt < overhead ) overhead = dt;
+    } // end for
+
+    printf(
+        "# libcoocvt v%d.%02d Kepler solver map: grid = %s, NE = %d, NM = %d, "
+        "reps = %d, tick overhead = %llu\n",
+        coo_get_major_version(), coo_get_minor_version(),
+        (grid == 'o') ? "log" : "lin", ne, nm, reps,
+        (unsigned long long)overhead
+    );
+    printf( "ecc,ma,ea,res,res_eps,ticks\n" );
+
+    volatile double sink = 0.0;
+    long double     rmax = 0.0L;
+
+    for (int ke = 0; ke < ne; ke++)
+    {
+        /* lin: e = 0 ... 1 - 1/NE, log: 1 - e = 1 ... 10^-DEC */
+        const double ecc = (grid == 'o')
+                         ? 1.0 - pow( 10.0, -dec * ke / (ne - 1) )
+                         : (double)ke / ne;
+
+        for (int km = 0; km < nm; km++)
+        {
+            /* lin: M = 0 ... pi, log: M = 10^-DEC ... pi */
+            const double ma = (grid == 'o')
+                            ? M_PI * pow( 10.0, -dec * (nm - 1 - km) / (nm - 1) )
+                            : M_PI * km / (nm - 1);
+
+            /* cost per call */
+            uint64_t ticks = UINT64_MAX;
+            double   ea    = 0.0;
+            for (int r = 0; r < reps; r++)
+            {
+                const uint64_t t0 = bench_ticks();
+                ea                = coo_kesolver( ecc, ma );
+                const uint64_t dt = bench_ticks() - t0;
+                if ( dt < ticks ) ticks = dt;
+                sink += ea;
+            } // end for
+            ticks = (ticks > overhead) ? ticks - overhead : 0;
+
+            /* residual of Kepler Equation in extended precision */
+            const long double res = fabsl(
+                (long double)ma - (long double)ea
+                + (long double)ecc * sinl( (long double)ea )
+            );
+            if ( res > rmax ) rmax = res;
+
+            printf(
+                "%.17g,%.17g,%.17g,%.6Le,%.3Lf,%llu\n",
+                ecc, ma, ea, res,
+                (ea > 0.0) ? res / (DBL_EPSILON * (long double)ea) : 0.0L,
+                (unsigned long long)ticks
+            );
+        } // end for
+    } // end for
+
+    printf( "# maximum residual: %.6Le\n", rmax );
+    if ( sink == 1.0 ) printf( "# %g\n", sink );
+
+    return 0;
+} // end main
+
+/******************************************************************************/
@@ -0,0 +1,422 @@
+/*******************************************************************************
+ * @file    cootrip.c
+ * @brief   round-trip accuracy versus throughput harness for libcoocvt
+ * @details sweeps a grid in eccentricity and inclination, samples the mean
+ *          anomaly in every cell and runs hel2hco() -> hco2hel() round trips;
+ *          reports maximum and RMS error per orbital element together with
+ *          the time per body and round trip; checks the error bounds in
+ *          ulp of the approximations of fastmath.h against long double
+ *          references of libm
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include benchmark helpers (first) */
+#include "bench.h"
+#include <float.h>
+
+/* include internal header of library */
+#include "fastmath.h"
+
+/******************************************************************************/
+
+/*** internal constants ***/
+
+/* number of compared quantities: sma, ecc, inc, lan, aph, man, mean longitude */
+#define TRIP_NUM 7
+
+/* names of compared quantities */
+static const char* const trip_name[TRIP_NUM] = {
+    "sma", "ecc", "inc", "lan", "aph", "man", "lam"
+};
+
+/* number of checked approximations: atan2, hypot, cbrt, atan2f */
+#define ULP_NUM 4
+
+/* names of checked approximations */
+static const char* const ulp_name[ULP_NUM] = {
+    "atan2", "hypot", "cbrt", "atan2f"
+};
+
+/* error bounds in ulp stated in fastmath.h */
+static const double ulp_bound[ULP_NUM] = { 1.70, 1.25, 0.74, 3.25 };
+
+/******************************************************************************/
+
+/* print usage information */
+static void usage(const char* prog)
+{
+    fprintf(
+        stderr,
+        "usage: %s [-e NE] [-E EMAX] [-i NI] [-I IMAX] [-m NM] [-r REPS] "
+        "[-s SEED] [-u NU]\n"
+        "  -e NE    number of eccentricity grid points (default 8)\n"
+        "  -E EMAX  largest eccentricity of grid (default 0.95)\n"
+        "  -i NI    number of inclination grid points (default 4)\n"
+        "  -I IMAX  largest inclination of grid in degrees (default 90)\n"
+        "  -m NM    mean anomaly samples per grid cell (default 4096)\n"
+        "  -r REPS  repetitions, minimum time is reported (default 5)\n"
+        "  -s SEED  random seed (default 42)\n"
+        "  -u NU    random arguments of ulp check, 0 skips (default 1000000)\n"
+        "  errors: sma relative, angles in radians wrapped to [-pi, pi],\n"
+        "  lam = lan + aph + man stays defined for circular or planar orbits\n",
+        prog
+    );
+} // end usage
+
+/******************************************************************************/
+
+/* difference of two angles, wrapped to [-pi, pi] */
+static double angle_diff(const double a, const double b)
+{
+    return( remainder( a - b, 2.0 * M_PI ) );
+} // end angle_diff
+
+/******************************************************************************/
+
+/* errors of one body after round trip, in order of trip_name */
+static void trip_errors(
+    double              err[TRIP_NUM],
+    const hel_t* const  ref,
+    const hel_t* const  res
+    )
+{
+    err[0] = fabs( res->sma / ref->sma - 1.0 );
+    err[1] = fabs( res->ecc - ref->ecc );
+    err[2] = fabs( angle_diff( res->inc, ref->inc ) );
+    err[3] = fabs( angle_diff( res->lan, ref->lan ) );
+    err[4] = fabs( angle_diff( res->aph, ref->aph ) );
+    err[5] = fabs( angle_diff( res->man, ref->man ) );
+    err[6] = fabs( angle_diff(
+        res->lan + res->aph + res->man, ref->lan + ref->aph + ref->man
+    ) );
+} // end trip_errors
+
+/******************************************************************************/
+
+/* error of result in ulp of reference, p = number of mantissa bits */
+static double ulp_error(const long double res, const long double ref, const int p)
+{
+    return( (double)fabsl( (res - ref) / ldexpl( 1.0L, ilogbl( ref ) - p + 1 ) ) );
+} // end ulp_error
+
+/******************************************************************************/
+
+/* random sign */
+static double rand_sign(uint64_t* seed)
+{
+    return( (bench_rand( seed ) < 0.5) ? -1.0 : 1.0 );
+} // end rand_sign
+
+/******************************************************************************/
+
+/* approximations of fastmath.h for arrays, vectorized with OpenMP */
+static void atan2_arr(
+    double* restrict r, const double* restrict y, const double* restrict x,
+    const uint32_t n
+)
+{
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (uint32_t i = 0; i < n; i++) r[i] = coo_atan2( y[i], x[i] );
+} // end atan2_arr
+
+static void hypot_arr(
+    double* restrict r, const double* restrict x, const double* restrict y,
+    const uint32_t n
+)
+{
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (uint32_t i = 0; i < n; i++) r[i] = coo_hypot( x[i], y[i] );
+} // end hypot_arr
+
+static void cbrt_arr(
+    double* restrict r, const double* restrict x, const uint32_t n
+)
+{
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (uint32_t i = 0; i < n; i++) r[i] = coo_cbrt( x[i] );
+} // end cbrt_arr
+
+static void atan2f_arr(
+    float* restrict r, const float* restrict y, const float* restrict x,
+    const uint32_t n
+)
+{
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (uint32_t i = 0; i < n; i++) r[i] = coo_atan2f( y[i], x[i] );
+} // end atan2f_arr
+
+/******************************************************************************/
+
+/* maximum errors in ulp of the approximations of fastmath.h, in order of
+ * ulp_name, over nu random arguments each; returns 1 if out of memory
+ */
+static int ulp_check(double emx[ULP_NUM], const uint32_t nu, uint64_t* seed)
+{
+    double* a  = malloc( (size_t)nu * sizeof(double) );
+    double* b  = malloc( (size_t)nu * sizeof(double) );
+    double* r  = malloc( (size_t)nu * sizeof(double) );
+    float*  af = malloc( (size_t)nu * sizeof(float) );
+    float*  bf = malloc( (size_t)nu * sizeof(float) );
+    float*  rf = malloc( (size_t)nu * sizeof(float) );
+    if ( (a == NULL) || (b == NULL) || (r == NULL)
+        || (af == NULL) || (bf == NULL) || (rf == NULL) )
+    {
+        free( a ); free( b ); free( r ); free( af ); free( bf ); free( rf );
+        return 1;
+    } // end if
+
+    for (int q = 0; q < ULP_NUM; q++) emx[q] = 0.0;
+
+    /* atan2: all quadrants, magnitudes and ratios log-uniform in 2^[-40, 40] */
+    for (uint32_t j = 0; j < nu; j++)
+    {
+        a[j] = rand_sign( seed ) * ldexp( 1.0 + bench_rand( seed ),
+                                   (int)(80.0 * bench_rand( seed )) - 40 );
+        b[j] = rand_sign( seed ) * ldexp( 1.0 + bench_rand( seed ),
+                                   (int)(80.0 * bench_rand( seed )) - 40 );
+    } // end for
+    atan2_arr( r, a, b, nu );
+    for (uint32_t j = 0; j < nu; j++)
+    {
+        const long double ref = atan2l( a[j], b[j] );
+        emx[0] = fmax( emx[0], ulp_error( r[j], ref, DBL_MANT_DIG ) );
+    } // end for
+
+    /* hypot: magnitudes in 2^[-1000, 1000], ratios in 2^[-30, 30], so that
+     * both components contribute and the scaled ranges are covered
+     */
+    for (uint32_t j = 0; j < nu; j++)
+    {
+        a[j] = rand_sign( seed ) * ldexp( 1.0 + bench_rand( seed ),
+                                   (int)(2000.0 * bench_rand( seed )) - 1000 );
+        b[j] = rand_sign( seed ) * ldexp( fabs( a[j] ) * (1.0 + bench_rand( seed )),
+                                   (int)(60.0 * bench_rand( seed )) - 30 );
+    } // end for
+    hypot_arr( r, a, b, nu );
+    for (uint32_t j = 0; j < nu; j++)
+    {
+        const long double ref = hypotl( a[j], b[j] );
+        emx[1] = fmax( emx[1], ulp_error( r[j], ref, DBL_MANT_DIG ) );
+    } // end for
+
+    /* cbrt: whole range of finite doubles, including subnormals */
+    for (uint32_t j = 0; j < nu; j++)
+    {
+        a[j] = rand_sign( seed ) * ldexp( 1.0 + bench_rand( seed ),
+                                   (int)(2096.0 * bench_rand( seed )) - 1073 );
+    } // end for
+    cbrt_arr( r, a, nu );
+    for (uint32_t j = 0; j < nu; j++)
+    {
+        const long double ref = cbrtl( a[j] );
+        emx[2] = fmax( emx[2], ulp_error( r[j], ref, DBL_MANT_DIG ) );
+    } // end for
+
+    /* atan2f: as atan2, double reference is exact enough for float */
+    for (uint32_t j = 0; j < nu; j++)
+    {
+        af[j] = (float)(rand_sign( seed ) * ldexp( 1.0 + bench_rand( seed ),
+                                   (int)(80.0 * bench_rand( seed )) - 40 ));
+        bf[j] = (float)(rand_sign( seed ) * ldexp( 1.0 + bench_rand( seed ),
+                                   (int)(80.0 * bench_rand( seed )) - 40 ));
+    } // end for
+    atan2f_arr( rf, af, bf, nu );
+    for (uint32_t j = 0; j < nu; j++)
+    {
+        const long double ref = atan2( (double)af[j], (double)bf[j] );
+        emx[3] = fmax( emx[3], ulp_error( rf[j], ref, FLT_MANT_DIG ) );
+    } // end for
+
+    free( a ); free( b ); free( r ); free( af ); free( bf ); free( rf );
+    return 0;
+} // end ulp_check
+
+/******************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    int      ne   = 8;
+    int      ni   = 4;
+    uint32_t nm   = 4096;
+    uint32_t nu   = 1000000;
+    int      reps = 5;
+    uint64_t seed = 42;
+    double   emax = 0.95;
+    double   imax = 90.0;
+
+    /* parse command line */
+    for (int k = 1; k < argc; k++)
+    {
+        if ( (argv[k][0] != '-') || (k + 1 >= argc) )
+        {
+            usage( argv[0] );
+            return 1;
+        } // end if
+        const char* arg = argv[++k];
+        int         err = 0;
+        switch ( argv[k - 1][1] )
+        {
+            case 'e': ne   = atoi( arg );                         break;
+            case 'E': emax = atof( arg );                         break;
+            case 'i': ni   = atoi( arg );                         break;
+            case 'I': imax = atof( arg );                         break;
+            case 'm': nm   = (uint32_t)strtoul( arg, NULL, 10 );  break;
+            case 'r': reps = atoi( arg );                         break;
+            case 's': seed = strtoull( arg, NULL, 10 );           break;
+            case 'u': nu   = (uint32_t)strtoul( arg, NULL, 10 );  break;
+            default : err  = 1;                                   break;
+        } // end switch
+        if ( err || (ne < 1) || (ni < 1) || (nm < 1) || (reps < 1)
+            || (seed == 0) || (emax < 0.0) || (emax >= 1.0)
+            || (imax < 0.0) || (imax > 180.0) )
+        {
+            usage( argv[0] );
+            return 1;
+        } // end if
+    } // end for
+
+    /* one central body plus nm test bodies per grid cell */
+    const uint32_t dim = nm + 1;
+    body_t*        obj = malloc( (size_t)dim * sizeof(body_t) );
+    hel_t*         ref = malloc( (size_t)dim * sizeof(hel_t) );
+    if ( (obj == NULL) || (ref == NULL) )
+    {
+        fprintf( stderr, "%s: Error = out of memory\n", argv[0] );
+        return 1;
+    } // end if
+
+    printf(
+        "# libcoocvt v%d.%02d round trip hel2hco -> hco2hel: "
+        "NE = %d, NI = %d, NM = %u, reps = %d\n",
+        coo_get_major_version(), coo_get_minor_version(), ne, ni, nm, reps
+    );
+    printf( "# %6s %7s %12s", "ecc", "inc/deg", "ns/body" );
+    for (int q = 0; q < TRIP_NUM; q++)
+    {
+        printf( "  max_%-3s    rms_%-3s   ", trip_name[q], trip_name[q] );
+    } // end for
+    printf( "\n" );
+
+    double   gmax[TRIP_NUM] = { 0.0 };
+    uint32_t fails          = 0;
+
+    for (int ke = 0; ke < ne; ke++)
+    {
+        const double ecc = (ne > 1) ? emax * ke / (ne - 1) : emax;
+
+        for (int ki = 0; ki < ni; ki++)
+        {
+            const double inc = ((ni > 1) ? imax * ki / (ni - 1) : imax)
+                             * M_PI / 180.0;
+
+            /* test bodies of this cell */
+            memset( obj, 0, (size_t)dim * sizeof(body_t) );
+            obj[0].mass = 1.0;
+            for (uint32_t j = 1; j < dim; j++)
+            {
+                obj[j].mass    = 1.0e-10 * pow( 1.0e7, bench_rand( &seed ) );
+                obj[j].hel.sma = 0.5 * pow( 100.0, bench_rand( &seed ) );
+                obj[j].hel.ecc = ecc;
+                obj[j].hel.inc = inc;
+                obj[j].hel.aph = 2.0 * M_PI * bench_rand( &seed );
+                obj[j].hel.lan = 2.0 * M_PI * bench_rand( &seed );
+                obj[j].hel.man = 2.0 * M_PI * (j - 1) / nm;
+                ref[j]         = obj[j].hel;
+            } // end for
+
+            /* timed round trips, restart from reference elements */
+            double time = INFINITY;
+            for (int r = 0; r < reps; r++)
+            {
+                for (uint32_t j = 1; j < dim; j++) obj[j].hel = ref[j];
+                const double t0 = bench_ns();
+                fails += (uint32_t)coocvt( obj, dim, 0, CVT_HEL2HCO );
+                fails += (uint32_t)coocvt( obj, dim, 0, CVT_HCO2HEL );
+                time   = fmin( time, bench_ns() - t0 );
+            } // end for
+
+            /* error statistics of this cell */
+            double emx[TRIP_NUM] = { 0.0 };
+            double ems[TRIP_NUM] = { 0.0 };
+            for (uint32_t j = 1; j < dim; j++)
+            {
+                double err[TRIP_NUM];
+                trip_errors( err, &ref[j], &obj[j].hel );
+                for (int q = 0; q < TRIP_NUM; q++)
+                {
+                    emx[q]  = fmax( emx[q], err[q] );
+                    ems[q] += err[q] * err[q];
+                } // end for
+            } // end for
+
+            printf( "  %6.3f %7.2f %12.2f", ecc, inc * 180.0 / M_PI, time / nm );
+            for (int q = 0; q < TRIP_NUM; q++)
+            {
+                printf( "  %10.3e %10.3e", emx[q], sqrt( ems[q] / nm ) );
+                gmax[q] = fmax( gmax[q], emx[q] );
+            } // end for
+            printf( "\n" );
+        } // end for
+    } // end for
+
+    /* summary over whole grid */
+    printf( "# overall maximum:" );
+    for (int q = 0; q < TRIP_NUM; q++)
+    {
+        printf( " %s %.3e", trip_name[q], gmax[q] );
+    } // end for
+    printf( "\n# failed conversions: %u\n", fails );
+
+    free( ref );
+    free( obj );
+
+    /* error bounds of elementary functions */
+    uint32_t viol = 0;
+    if ( nu > 0 )
+    {
+        double emx[ULP_NUM];
+        if ( ulp_check( emx, nu, &seed ) != 0 )
+        {
+            fprintf( stderr, "%s: Error = out of memory\n", argv[0] );
+            return 1;
+        } // end if
+        printf( "# ulp check over %u random arguments:", nu );
+        for (int q = 0; q < ULP_NUM; q++)
+        {
+            printf( " %s %.3f (<= %.2f)", ulp_name[q], emx[q], ulp_bound[q] );
+            viol += (emx[q] > ulp_bound[q]) ? 1u : 0u;
+        } // end for
+        printf( "\n# violated error bounds: %u\n", viol );
+    } // end if
+
+    return( ((fails == 0) && (viol == 0)) ? 0 : 1 );
+} // end main
+
+/******************************************************************************/
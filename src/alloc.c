@@ -0,0 +1,385 @@
+/*******************************************************************************
+ * @file    alloc.c
+ * @brief   aligned, optionally huge-page-backed storage for object arrays
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#define _DEFAULT_SOURCE  /* for MAP_ANONYMOUS, madvise() */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__linux__)
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+/* include module headers */
+#include "alloc.h"
+#include "context.h"
+
+/******************************************************************************/
+
+/*** pre-processor definitions ***/
+
+/* map anonymous memory ? 1 = mmap (Linux), 0 = malloc */
+#if defined(__linux__)
+    #define ALLOC_MMAP 1
+#else
+    #define ALLOC_MMAP 0
+#endif
+
+/* alignment of arrays, one cache line / AVX-512 vector */
+#define ALLOC_ALIGN     64u
+
+/* size of transparent / explicit huge pages */
+#define ALLOC_HUGE_SIZE (2u << 20)
+
+/* number of SoA arrays in body_soa_t */
+#define ALLOC_SOA_NUM   13u
+
+/* tag for header of allocated blocks */
+#define ALLOC_MAGIC     0x636f6f616c6c6f63ull
+
+/******************************************************************************/
+
+/*** internal data structures ***/
+
+/* header stored in the cache line before each allocated block */
+typedef union
+{
+    struct
+    {
+        uint64_t magic; // ALLOC_MAGIC
+        void*    base;  // start of mapping or malloc() block
+        size_t   len;   // length of mapping, 0 for malloc() block
+    } h;
+    unsigned char pad[ALLOC_ALIGN];
+} alloc_hdr_t;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : alloc_block
+ *  DESCRIPTION : allocate zero-initialised, 64-byte aligned block of memory
+ *  INPUT       : - "size" of block in bytes
+ *                - allocation "flags"
+ *  OUTPUT      : pointer to block, nullptr if out of memory
+ *  NOTE        : the header is stored in the 64 bytes before the block;
+ *                huge page mappings are aligned to the huge page size
+ ******************************************************************************/
+static void* alloc_block(
+    const size_t   size,
+    const uint32_t flags
+    )
+{
+    alloc_hdr_t hdr = { .h = { ALLOC_MAGIC, nullptr, 0 } };
+    char*       blk = nullptr;
+
+#if ALLOC_MMAP
+    const bool   huge  = (flags & (COO_ALLOC_HUGE | COO_ALLOC_HUGETLB)) != 0;
+    const size_t page  = (size_t)sysconf( _SC_PAGESIZE );
+    const size_t align = huge ? ALLOC_HUGE_SIZE : page;
+    const size_t len   = (sizeof(alloc_hdr_t) + size + align - 1u) / align * align;
+    void*        base  = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    /* explicit huge pages, fails if none are reserved */
+    if ( flags & COO_ALLOC_HUGETLB )
+    {
+        base = mmap( nullptr, len, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+    } // end if
+#endif
+
+    if ( base == MAP_FAILED )
+    {
+        /* over-allocate, then trim to alignment of huge pages */
+        const size_t extra = huge ? align : 0u;
+        char* const  raw   = mmap( nullptr, len + extra, PROT_READ | PROT_WRITE,
+                                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if ( raw == MAP_FAILED ) return nullptr;
+
+        char* const start = (char*)(((uintptr_t)raw + align - 1u)
+                                    / align * align);
+        if ( start > raw ) munmap( raw, (size_t)(start - raw) );
+        const size_t tail = (size_t)(raw + len + extra - (start + len));
+        if ( tail > 0 ) munmap( start + len, tail );
+        base = start;
+
+#ifdef MADV_HUGEPAGE
+        /* transparent huge pages, only a hint */
+        if ( huge ) (void)madvise( base, len, MADV_HUGEPAGE );
+#endif
+    } // end if
+
+    hdr.h.base = base;
+    hdr.h.len  = len;
+    blk        = (char*)base + sizeof(alloc_hdr_t);
+#else
+    (void)flags;
+
+    /* malloc() block with room for header and alignment */
+    char* const raw = calloc( 1, size + 2u * sizeof(alloc_hdr_t) );
+    if ( raw == nullptr ) return nullptr;
+
+    hdr.h.base = raw;
+    blk        = (char*)(((uintptr_t)raw + 2u * sizeof(alloc_hdr_t) - 1u)
+                         / ALLOC_ALIGN * ALLOC_ALIGN);
+#endif
+
+    memcpy( blk - sizeof(alloc_hdr_t), &hdr, sizeof(alloc_hdr_t) );
+
+    return blk;
+} // end alloc_block
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : free_block
+ *  DESCRIPTION : release block of memory allocated with alloc_block()
+ *  INPUT       : - pointer "blk" to block (may be nullptr)
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void free_block(void* blk)
+{
+    if ( blk == nullptr ) return;
+
+    alloc_hdr_t hdr;
+    memcpy( &hdr, (char*)blk - sizeof(alloc_hdr_t), sizeof(alloc_hdr_t) );
+    if ( hdr.h.magic != ALLOC_MAGIC )
+    {
+        /* TODO print error message */
+        return;
+    } // end if
+
+#if ALLOC_MMAP
+    munmap( hdr.h.base, hdr.h.len );
+#else
+    free( hdr.h.base );
+#endif
+
+    return;
+} // end free_block
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_alloc_array
+ *  DESCRIPTION : allocate zero-initialised storage for an array of objects
+ *                of any type, e.g. hco_t, hel_t or double
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - number "dim" of entries
+ *                - "size" of one entry in bytes
+ *                - allocation "flags"
+ *  OUTPUT      : pointer to array, nullptr if out of memory
+ *  NOTE        : pages are touched in blocks of 64 entries, distributed over
+ *                the threads of "ctx" like the blocks of the conversions
+ ******************************************************************************/
+void* coo_alloc_array(
+    const coo_ctx_t* ctx,
+    const uint32_t   dim,
+    const size_t     size,
+    const uint32_t   flags
+    )
+{
+    /* check input */
+    if ( (dim == 0) || (size == 0) || (size > SIZE_MAX / 2u / dim) )
+    {
+        return nullptr;
+    } // end if
+
+    char* const arr = alloc_block( (size_t)dim * size, flags );
+    if ( arr == nullptr ) return nullptr;
+
+    if ( flags & COO_ALLOC_PREFAULT )
+    {
+        const uint32_t nwords = COO_MASK_WORDS(dim);
+#ifdef _OPENMP
+        const int nthr = coo_ctx_threads( ctx, 1 );
+        #pragma omp parallel num_threads(nthr) if(nthr > 1)
+#endif
+        {
+            /* pin each thread for the loop, restore its affinity after it */
+            coo_ctx_pin( ctx );
+
+#ifdef _OPENMP
+            #pragma omp for schedule(static)
+#endif
+            for (uint32_t w = 0; w < nwords; w++)
+            {
+                const uint32_t lo = w * 64u;
+                const uint32_t hi = (dim - lo < 64u) ? dim : lo + 64u;
+                memset( &arr[(size_t)lo * size], 0, (size_t)(hi - lo) * size );
+            } // end for
+
+            coo_ctx_unpin( ctx );
+        } // end parallel
+    } // end if
+
+    return arr;
+} // end coo_alloc_array
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_free_array
+ *  DESCRIPTION : release storage allocated with coo_alloc_array()
+ *  INPUT       : - pointer "arr" to array (may be nullptr)
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_free_array(void* arr)
+{
+    free_block( arr );
+} // end coo_free_array
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_alloc_bodies
+ *  DESCRIPTION : allocate zero-initialised storage for an array of objects
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - number "dim" of objects
+ *                - allocation "flags"
+ *  OUTPUT      : pointer to array of type body_t, nullptr if out of memory
+ ******************************************************************************/
+body_t* coo_alloc_bodies(
+    const coo_ctx_t* ctx,
+    const uint32_t   dim,
+    const uint32_t   flags
+    )
+{
+    return( coo_alloc_array( ctx, dim, sizeof(body_t), flags ) );
+} // end coo_alloc_bodies
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_free_bodies
+ *  DESCRIPTION : release storage allocated with coo_alloc_bodies()
+ *  INPUT       : - pointer "obj" to array of type body_t (may be nullptr)
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_free_bodies(body_t* obj)
+{
+    free_block( obj );
+} // end coo_free_bodies
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_alloc_soa
+ *  DESCRIPTION : allocate zero-initialised structure-of-arrays storage
+ *  INPUT       : - pointer "soa" of type body_soa_t to set up
+ *                - pointer "ctx" to conversion context (may be nullptr)
+ *                - number "dim" of objects
+ *                - allocation "flags"
+ *  OUTPUT      : 0 for success, 1 for error
+ *  NOTE        : the arrays are padded to multiples of 8 entries and share
+ *                one block; pages are touched like in coo_alloc_bodies()
+ ******************************************************************************/
+int coo_alloc_soa(
+    body_soa_t*      soa,
+    const coo_ctx_t* ctx,
+    const uint32_t   dim,
+    const uint32_t   flags
+    )
+{
+    /* check input */
+    if ( (soa == nullptr) || (dim == 0) ) return 1;
+
+    /* entries per array, padded to full cache lines */
+    const size_t stride = ((size_t)dim + 7u) / 8u * 8u;
+
+    double* const blk = alloc_block(
+        ALLOC_SOA_NUM * stride * sizeof(double), flags
+    );
+    if ( blk == nullptr ) return 1;
+
+    double** const arr[ALLOC_SOA_NUM] = {
+        &soa->x,   &soa->y,   &soa->z,
+        &soa->vx,  &soa->vy,  &soa->vz,
+        &soa->sma, &soa->ecc, &soa->inc,
+        &soa->aph, &soa->lan, &soa->man,
+        &soa->mass
+    };
+    for (register uint32_t k = 0; k < ALLOC_SOA_NUM; k++)
+    {
+        *arr[k] = blk + k * stride;
+    } // end for
+    soa->dim = dim;
+
+    if ( flags & COO_ALLOC_PREFAULT )
+    {
+        const uint32_t nwords = COO_MASK_WORDS(dim);
+#ifdef _OPENMP
+        const int nthr = coo_ctx_threads( ctx, 1 );
+        #pragma omp parallel num_threads(nthr) if(nthr > 1)
+#endif
+        {
+            /* pin each thread for the loop, restore its affinity after it */
+            coo_ctx_pin( ctx );
+
+#ifdef _OPENMP
+            #pragma omp for schedule(static)
+#endif
+            for (uint32_t w = 0; w < nwords; w++)
+            {
+                const uint32_t lo = w * 64u;
+                const uint32_t hi = (dim - lo < 64u) ? dim : lo + 64u;
+                for (register uint32_t k = 0; k < ALLOC_SOA_NUM; k++)
+                {
+                    memset( &blk[k * stride + lo], 0,
+                            (size_t)(hi - lo) * sizeof(double) );
+                } // end for
+            } // end for
+
+            coo_ctx_unpin( ctx );
+        } // end parallel
+    } // end if
+
+    return 0;
+} // end coo_alloc_soa
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_free_soa
+ *  DESCRIPTION : release storage allocated with coo_alloc_soa()
+ *  INPUT       : - pointer "soa" of type body_soa_t (may be nullptr)
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_free_soa(body_soa_t* soa)
+{
+    if ( soa == nullptr ) return;
+
+    /* first array is the start of the block */
+    free_block( soa->x );
+
+    *soa = (body_soa_t){ 0 };
+
+    return;
+} // end coo_free_soa
+
+/******************************************************************************/
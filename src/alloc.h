@@ -0,0 +1,131 @@
+/***************************************************************************//**
+ * @file    alloc.h
+ * @brief   aligned, optionally huge-page-backed storage for object arrays
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_ALLOC__H
+#define COO_ALLOC__H
+
+/******************************************************************************/
+
+/*** include pre-requisite headers ***/
+
+/* include module headers */
+#include "types.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief allocate zero-initialised storage for a compact array
+ * @details for arrays of a single representation, e.g. #hco_t, #hel_t or
+ * double masses, see hco2hel_arr() and hel2hco_arr(); alignment, huge pages
+ * and prefaulting as for coo_alloc_bodies()
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in] dim number of entries (> 0)
+ * @param[in] size size of one entry in bytes
+ * @param[in] flags combination of COO_ALLOC_* flags
+ * @return pointer to array, nullptr if out of memory; release with
+ * coo_free_array()
+ */
+void* coo_alloc_array(
+    const coo_ctx_t* ctx,
+    const uint32_t   dim,
+    const size_t     size,
+    const uint32_t   flags
+);
+
+
+/*!
+ * @brief release storage allocated with coo_alloc_array()
+ * @param[in] arr pointer to array (may be nullptr)
+ * @return none
+ */
+void coo_free_array(void* arr);
+
+
+/*!
+ * @brief allocate zero-initialised storage for an array of objects
+ * @details the array is 64-byte aligned; with #COO_ALLOC_PREFAULT all pages
+ * are touched by the threads of \a ctx in blocks of 64 objects with the
+ * same static partition as the conversion kernels, so that first-touch
+ * placement matches the threads that later convert the data
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in] dim number of objects (> 0)
+ * @param[in] flags combination of COO_ALLOC_* flags
+ * @return pointer to array of type #body_t, nullptr if out of memory;
+ * release with coo_free_bodies()
+ */
+body_t* coo_alloc_bodies(
+    const coo_ctx_t* ctx,
+    const uint32_t   dim,
+    const uint32_t   flags
+);
+
+
+/*!
+ * @brief release storage allocated with coo_alloc_bodies()
+ * @param[in] obj pointer to array of type #body_t (may be nullptr)
+ * @return none
+ */
+void coo_free_bodies(body_t* obj);
+
+
+/*!
+ * @brief allocate zero-initialised structure-of-arrays storage
+ * @details all arrays of \a soa share one block and are 64-byte aligned;
+ * see coo_alloc_bodies() for \a ctx and \a flags
+ * @param[out] soa structure of type #body_soa_t to set up
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in] dim number of objects (> 0)
+ * @param[in] flags combination of COO_ALLOC_* flags
+ * @return 0 for success, 1 for error; release with coo_free_soa()
+ */
+int coo_alloc_soa(
+    body_soa_t*      soa,
+    const coo_ctx_t* ctx,
+    const uint32_t   dim,
+    const uint32_t   flags
+);
+
+
+/*!
+ * @brief release storage allocated with coo_alloc_soa()
+ * @details all pointers of \a soa are reset to nullptr
+ * @param[in,out] soa structure of type #body_soa_t (may be nullptr)
+ * @return none
+ */
+void coo_free_soa(body_soa_t* soa);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* COO_ALLOC__H */
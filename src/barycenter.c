@@ -0,0 +1,268 @@
+/*******************************************************************************
+ * @file    barycenter.c
+ * @brief   incremental barycenter (center of mass) accumulator
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <stdbool.h>
+
+/* include module headers */
+#include "barycenter.h"
+#include "csum.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/*** pre-processor definitions ***/
+
+/* show verbose debugging output ? 0 = no (default), 1 = yes */
+#define COO_BARYCENTER_DEBUG 0
+#if COO_BARYCENTER_DEBUG
+    #include <stdio.h>
+#endif
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : get_coo
+ *  DESCRIPTION : select Cartesian coordinates of given type from an object
+ *  INPUT       : - pointer "obj" of type body_t
+ *                - coordinate "type" from enum COO_TYPE_e
+ *  OUTPUT      : pointer to coordinates, nullptr for invalid type
+ ******************************************************************************/
+static inline const hco_t* get_coo(
+    const body_t* const obj,
+    const COO_TYPE_e    type
+    )
+{
+    switch ( type )
+    {
+        case COO_BCO: return( &obj->bco );
+        case COO_HCO: return( &obj->hco );
+        case COO_JCO: return( &obj->jco );
+        case COO_PCO: return( &obj->pco );
+
+        /* TODO FIXME implement barycenter for case COO_RCO */
+        default:      return( nullptr );
+    } // end switch
+} // end get_coo
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : accumulate
+ *  DESCRIPTION : add mass-weighted coordinates to accumulator;
+ *                use negative "mass" for removing an object
+ *  INPUT       : - pointer "acc" of type bcacc_t
+ *                - pointer "coo" to coordinates of type hco_t
+ *                - value "mass" of object
+ *                - Boolean "with_mass" whether to update the total mass
+ *  OUTPUT      : none
+ ******************************************************************************/
+static inline void accumulate(
+    bcacc_t*           acc,
+    const hco_t* const coo,
+    const double       mass,
+    const bool         with_mass
+    )
+{
+    if ( with_mass ) csum_add( &acc->sum[0], &acc->err[0], mass );
+    csum_add( &acc->sum[1], &acc->err[1], mass * coo->pos.x );
+    csum_add( &acc->sum[2], &acc->err[2], mass * coo->pos.y );
+    csum_add( &acc->sum[3], &acc->err[3], mass * coo->pos.z );
+    csum_add( &acc->sum[4], &acc->err[4], mass * coo->vel.x );
+    csum_add( &acc->sum[5], &acc->err[5], mass * coo->vel.y );
+    csum_add( &acc->sum[6], &acc->err[6], mass * coo->vel.z );
+} // end accumulate
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_bcacc_init
+ *  DESCRIPTION : reset barycenter accumulator to an empty system
+ *  INPUT       : pointer "acc" of type bcacc_t
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_bcacc_init(bcacc_t* acc)
+{
+    for (register int k = 0; k < 7; k++)
+    {
+        acc->sum[k] = 0.0;
+        acc->err[k] = 0.0;
+    } // end for
+    acc->count = 0;
+} // end coo_bcacc_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_bcacc_fill
+ *  DESCRIPTION : fill barycenter accumulator from array of objects
+ *  INPUT       : - pointer "acc" of type bcacc_t
+ *                - pointer to array "obj" of type body_t
+ *                - starting index "fromIdx"
+ *                - final index "uptoIdx"
+ *                - coordinate "type" from enum COO_TYPE_e
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coo_bcacc_fill(
+    bcacc_t*         acc,
+    const body_t     obj[],
+    const uint32_t   fromIdx,
+    const uint32_t   uptoIdx,
+    const COO_TYPE_e type
+    )
+{
+    /* check input for invalid pointers */
+    if ( (acc == nullptr) || (obj == nullptr) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* check array indices and coordinate type */
+    if ( (fromIdx > uptoIdx) || (get_coo( &obj[0], type ) == nullptr) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    coo_bcacc_init( acc );
+    for (register uint32_t i = fromIdx; i < uptoIdx; i++)
+    {
+        accumulate( acc, get_coo( &obj[i], type ), obj[i].mass, true );
+    } // end for
+    acc->count = uptoIdx - fromIdx;
+
+    return 0;
+} // end coo_bcacc_fill
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_bcacc_add
+ *  DESCRIPTION : add a single object to barycenter accumulator
+ *  INPUT       : - pointer "acc" of type bcacc_t
+ *                - pointer "coo" to coordinates of type hco_t
+ *                - value "mass" of object
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_bcacc_add(
+    bcacc_t*           acc,
+    const hco_t* const coo,
+    const double       mass
+    )
+{
+    accumulate( acc, coo, mass, true );
+    acc->count++;
+} // end coo_bcacc_add
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_bcacc_remove
+ *  DESCRIPTION : remove a single object from barycenter accumulator
+ *  INPUT       : - pointer "acc" of type bcacc_t
+ *                - pointer "coo" to coordinates of type hco_t
+ *                - value "mass" of object
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_bcacc_remove(
+    bcacc_t*           acc,
+    const hco_t* const coo,
+    const double       mass
+    )
+{
+    accumulate( acc, coo, -mass, true );
+    if ( acc->count > 0 ) acc->count--;
+} // end coo_bcacc_remove
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_bcacc_update
+ *  DESCRIPTION : replace coordinates of a single object in accumulator;
+ *                total mass stays unchanged
+ *  INPUT       : - pointer "acc" of type bcacc_t
+ *                - pointer "old" to previous coordinates of type hco_t
+ *                - pointer "coo" to new coordinates of type hco_t
+ *                - value "mass" of object
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_bcacc_update(
+    bcacc_t*           acc,
+    const hco_t* const old,
+    const hco_t* const coo,
+    const double       mass
+    )
+{
+    accumulate( acc, old, -mass, false );
+    accumulate( acc, coo,  mass, false );
+} // end coo_bcacc_update
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_bcacc_get
+ *  DESCRIPTION : return barycenter position and velocity from accumulator
+ *  INPUT       : - pointer "bc" of type hco_t for barycenter coordinates
+ *                - pointer "acc" of type bcacc_t
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coo_bcacc_get(
+    hco_t*               bc,
+    const bcacc_t* const acc
+    )
+{
+    /* check input for invalid pointers */
+    if ( (bc == nullptr) || (acc == nullptr) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* total mass must be positive */
+    const double mtot = csum_get( acc->sum[0], acc->err[0] );
+    if ( !(mtot > 0.0) )
+    {
+#if COO_BARYCENTER_DEBUG
+    fprintf( stderr, "%s: Error = invalid total mass %g\n", __func__, mtot );
+#endif
+        return 1;
+    } // end if
+
+    /* scale with inverse of total mass of system */
+    const double imtot = 1.0 / mtot;
+
+    *bc = hco_zero;
+    bc->pos.x = csum_get( acc->sum[1], acc->err[1] ) * imtot;
+    bc->pos.y = csum_get( acc->sum[2], acc->err[2] ) * imtot;
+    bc->pos.z = csum_get( acc->sum[3], acc->err[3] ) * imtot;
+    bc->vel.x = csum_get( acc->sum[4], acc->err[4] ) * imtot;
+    bc->vel.y = csum_get( acc->sum[5], acc->err[5] ) * imtot;
+    bc->vel.z = csum_get( acc->sum[6], acc->err[6] ) * imtot;
+
+    return 0;
+} // end coo_bcacc_get
+
+/******************************************************************************/
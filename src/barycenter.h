@@ -0,0 +1,132 @@
+/***************************************************************************//**
+ * @file    barycenter.h
+ * @brief   incremental barycenter (center of mass) accumulator
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_BARYCENTER__H
+#define COO_BARYCENTER__H
+
+/******************************************************************************/
+
+/*** include pre-requisite headers ***/
+
+/* include module headers */
+#include "types.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief reset barycenter accumulator to an empty system
+ * @param[out] acc pointer to accumulator of type #bcacc_t
+ * @return none
+ */
+void coo_bcacc_init(bcacc_t* acc);
+
+
+/*!
+ * @brief fill barycenter accumulator from array of objects
+ * @details accumulator holds objects in range [fromIdx : uptoIdx-1]
+ * @param[out] acc pointer to accumulator of type #bcacc_t
+ * @param[in] obj input array of type #body_t
+ * @param[in] fromIdx lowest index in array \a obj
+ * @param[in] uptoIdx highest index in array \a obj
+ * @param[in] type coordinate type from enum #COO_TYPE_e
+ * @return 0 for success, 1 for error
+ */
+int coo_bcacc_fill(
+    bcacc_t*         acc,
+    const body_t     obj[],
+    const uint32_t   fromIdx,
+    const uint32_t   uptoIdx,
+    const COO_TYPE_e type
+);
+
+
+/*!
+ * @brief add a single object to barycenter accumulator
+ * @param[in,out] acc pointer to accumulator of type #bcacc_t
+ * @param[in] coo coordinates of object
+ * @param[in] mass mass of object
+ * @return none
+ */
+void coo_bcacc_add(
+    bcacc_t*           acc,
+    const hco_t* const coo,
+    const double       mass
+);
+
+
+/*!
+ * @brief remove a single object from barycenter accumulator
+ * @param[in,out] acc pointer to accumulator of type #bcacc_t
+ * @param[in] coo coordinates of object, as previously added
+ * @param[in] mass mass of object, as previously added
+ * @return none
+ */
+void coo_bcacc_remove(
+    bcacc_t*           acc,
+    const hco_t* const coo,
+    const double       mass
+);
+
+
+/*!
+ * @brief replace coordinates of a single object in barycenter accumulator
+ * @param[in,out] acc pointer to accumulator of type #bcacc_t
+ * @param[in] old previous coordinates of object
+ * @param[in] coo new coordinates of object
+ * @param[in] mass (unchanged) mass of object
+ * @return none
+ */
+void coo_bcacc_update(
+    bcacc_t*           acc,
+    const hco_t* const old,
+    const hco_t* const coo,
+    const double       mass
+);
+
+
+/*!
+ * @brief return barycenter position & velocity from accumulator
+ * @param[out] bc coordinates for center of mass (barycenter)
+ * @param[in] acc pointer to accumulator of type #bcacc_t
+ * @return 0 for success, 1 for error (empty system or total mass <= 0)
+ */
+int coo_bcacc_get(
+    hco_t*               bc,
+    const bcacc_t* const acc
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* COO_BARYCENTER__H */
@@ -35,14 +35,14 @@
  *                - index "center" for central body
  *  OUTPUT      : 0 = success, 1 = error
  ******************************************************************************/
-inline int bco2hco(
+COO_DISPATCH inline int bco2hco(
     body_t         obj[],
     const uint32_t dim,
     const uint32_t center
     )
 {
     /* check input */
-    if ( (obj == nullptr) || (dim < center) )
+    if ( (obj == nullptr) || (dim <= center) )
     {
         /* TODO FIXME print error message */
         return 1;
@@ -65,3 +65,47 @@ inline int bco2hco(
 } // end bco2hco
 
 /******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : bco2hco_oop
+ *  DESCRIPTION : convert from barycentric Cartesian coordinates to
+ *                heliocentric Cartesian coordinates, out of place
+ *  INPUT       : - pointer "dst" to array of type body_t for output
+ *                  (using members dst[].hco, other members are not touched)
+ *                - pointer "src" to array of type body_t for input
+ *                  (using members src[].bco), must not overlap with "dst"
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+COO_DISPATCH int bco2hco_oop(
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) || (dim <= center) )
+    {
+        /* TODO FIXME print error message */
+        return 1;
+    } // end if
+
+    /* coordinates of central body */
+    const hco_t bc = src[center].bco;
+
+    /***
+     * subtract barycentric position/velocity of object with index "center"
+     * to transform to heliocentric coordinates:
+     * hco = bco - bc
+     ***/
+    for (register uint32_t i = 0; i < dim; i++)
+    {
+        coo_recenter( &dst[i].hco, &src[i].bco, &bc );
+    } // end for
+
+    return 0;
+} // end bco2hco_oop
+
+/******************************************************************************/
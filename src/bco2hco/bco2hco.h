@@ -35,6 +35,24 @@ int bco2hco(
     const uint32_t center
 );
 
+
+/*!
+ * @brief convert barycentric coordinates to heliocentric coordinates,
+ * out of place
+ * @details reads src[].bco and writes dst[].hco only
+ * @param[out] dst array of type #body_t for output
+ * @param[in] src array of type #body_t for input, must not overlap \a dst
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body
+ * @return 0 for success, 1 for error
+ */
+int bco2hco_oop(
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,227 @@
+/*******************************************************************************
+ * @file    context.c
+ * @brief   reentrant conversion context
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+#include <stdlib.h>
+
+/* include module headers */
+#include "context.h"
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_ctx_create
+ *  DESCRIPTION : create a conversion context with default settings
+ *  INPUT       : none
+ *  OUTPUT      : pointer to new context, nullptr if out of memory
+ ******************************************************************************/
+coo_ctx_t* coo_ctx_create(void)
+{
+    /* all counters zero, no status bitmap */
+    coo_ctx_t* ctx = calloc( 1, sizeof(coo_ctx_t) );
+    if ( ctx == nullptr )
+    {
+        /* TODO print error message */
+        return nullptr;
+    } // end if
+
+    ctx->gm      = gaussk2;
+    ctx->threads = 0;
+
+    return ctx;
+} // end coo_ctx_create
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_ctx_destroy
+ *  DESCRIPTION : release a conversion context and all memory owned by it
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_ctx_destroy(coo_ctx_t* ctx)
+{
+    if ( ctx == nullptr ) return;
+
+    free( ctx->mask );
+    free( ctx->cpus );
+    free( ctx );
+
+    return;
+} // end coo_ctx_destroy
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_ctx_set_threads
+ *  DESCRIPTION : set number of threads for the parallel loops of a context
+ *  INPUT       : - pointer "ctx" to conversion context
+ *                - number of "threads", 0 = OpenMP default
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coo_ctx_set_threads(
+    coo_ctx_t* ctx,
+    const int  threads
+    )
+{
+    if ( (ctx == nullptr) || (threads < 0) ) return 1;
+
+    ctx->threads = threads;
+
+    return 0;
+} // end coo_ctx_set_threads
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_ctx_set_gm
+ *  DESCRIPTION : set gravitational constant of a context
+ *  INPUT       : - pointer "ctx" to conversion context
+ *                - gravitational constant "gm"
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coo_ctx_set_gm(
+    coo_ctx_t*   ctx,
+    const double gm
+    )
+{
+    if ( (ctx == nullptr) || !isfinite( gm ) || (gm <= 0.0) ) return 1;
+
+    ctx->gm = gm;
+
+    return 0;
+} // end coo_ctx_set_gm
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_ctx_set_numa
+ *  DESCRIPTION : enable or disable NUMA-aware execution of a context
+ *  INPUT       : - pointer "ctx" to conversion context
+ *                - Boolean "enable"
+ *  OUTPUT      : 0 for success, 1 for error
+ *  NOTE        : the topology is read again each time NUMA mode is enabled
+ ******************************************************************************/
+int coo_ctx_set_numa(
+    coo_ctx_t* ctx,
+    const bool enable
+    )
+{
+    if ( ctx == nullptr ) return 1;
+
+    /* drop previous topology */
+    free( ctx->cpus );
+    ctx->cpus  = nullptr;
+    ctx->ncpu  = 0;
+    ctx->nodes = 0;
+
+    if ( !enable ) return 0;
+
+    return( coo_numa_detect( &ctx->cpus, &ctx->ncpu, &ctx->nodes ) );
+} // end coo_ctx_set_numa
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_ctx_numa_nodes
+ *  DESCRIPTION : number of NUMA nodes used by a context
+ *  INPUT       : - pointer "ctx" to conversion context
+ *  OUTPUT      : number of nodes, 0 if NUMA mode is disabled
+ ******************************************************************************/
+uint32_t coo_ctx_numa_nodes(const coo_ctx_t* ctx)
+{
+    return( (ctx != nullptr) ? ctx->nodes : 0 );
+} // end coo_ctx_numa_nodes
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_ctx_mask
+ *  DESCRIPTION : status bitmap of the last conversion of a context
+ *  INPUT       : - pointer "ctx" to conversion context
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : pointer to status bitmap, nullptr if not available
+ ******************************************************************************/
+const uint64_t* coo_ctx_mask(
+    const coo_ctx_t* ctx,
+    uint32_t*        nfail
+    )
+{
+    if ( ctx == nullptr ) return nullptr;
+
+    if ( nfail != nullptr ) *nfail = ctx->nfail;
+
+    return( ctx->mask );
+} // end coo_ctx_mask
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_ctx_stats
+ *  DESCRIPTION : read counters of a context for a conversion mode
+ *  INPUT       : - pointer "ctx" to conversion context
+ *                - pointer "stats" of type stats_t
+ *                - conversion "mode" from enum CVT_MODE_e
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coo_ctx_stats(
+    const coo_ctx_t* ctx,
+    stats_t*         stats,
+    const CVT_MODE_e mode
+    )
+{
+    if ( (ctx == nullptr) || (stats == nullptr) ) return 1;
+    if ( (mode <= CVT_NONE) || (mode >= CVT_TOTAL_NUMBER) ) return 1;
+
+    *stats = ctx->stats[mode];
+
+    return 0;
+} // end coo_ctx_stats
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_ctx_reset_stats
+ *  DESCRIPTION : reset counters of a context for all conversion modes to zero
+ *  INPUT       : - pointer "ctx" to conversion context
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_ctx_reset_stats(coo_ctx_t* ctx)
+{
+    if ( ctx == nullptr ) return;
+
+    for (register int mode = 0; mode < CVT_TOTAL_NUMBER; mode++)
+    {
+        ctx->stats[mode].calls  = 0;
+        ctx->stats[mode].bodies = 0;
+        ctx->stats[mode].fails  = 0;
+        ctx->stats[mode].ticks  = 0;
+    } // end for
+
+    return;
+} // end coo_ctx_reset_stats
+
+/******************************************************************************/
@@ -0,0 +1,502 @@
+/***************************************************************************//**
+ * @file    context.h
+ * @brief   reentrant conversion context
+ * @details internal header, defines the layout of the opaque type #coo_ctx_t
+ *          and helpers for the conversion kernels
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_CONTEXT__H
+#define COO_CONTEXT__H
+
+/******************************************************************************/
+
+/*** include pre-requisite headers ***/
+
+/* include standard headers */
+#include <stdbool.h>
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+/* include module headers */
+#include "types.h"
+#include "const.h"
+#include "coocvt.h"
+#include "numa.h"
+#include "trace.h"
+
+/******************************************************************************/
+
+/*** define data structures ***/
+
+/*!
+ * @brief conversion context, owns all state of one independent simulation
+ */
+struct coo_ctx
+{
+    double    gm;                       ///< gravitational constant G
+    int       threads;                  ///< threads, 0 = OpenMP default
+    uint64_t* mask;                     ///< status bitmap of last conversion
+    uint32_t  mask_words;               ///< capacity of \a mask in words
+    uint32_t  nfail;                    ///< failed objects of last conversion
+    stats_t   stats[CVT_TOTAL_NUMBER];  ///< counters per conversion mode
+    int*      cpus;                     ///< CPUs by node, nullptr = no NUMA mode
+    uint32_t  ncpu;                     ///< number of entries in \a cpus
+    uint32_t  nodes;                    ///< number of NUMA nodes in \a cpus
+};
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief create a conversion context with default settings
+ * @details G = gaussk2, OpenMP default number of threads, empty status
+ * bitmap and counters; a context must not be used by several threads at
+ * the same time, but independent contexts can be used concurrently
+ * @return new context, nullptr if out of memory
+ */
+coo_ctx_t* coo_ctx_create(void);
+
+
+/*!
+ * @brief release a conversion context and all memory owned by it
+ * @param[in] ctx conversion context (may be nullptr)
+ * @return none
+ */
+void coo_ctx_destroy(coo_ctx_t* ctx);
+
+
+/*!
+ * @brief set number of threads for the parallel loops of a context
+ * @param[in,out] ctx conversion context
+ * @param[in] threads number of threads, 0 = OpenMP default
+ * @return 0 for success, 1 for error
+ */
+int coo_ctx_set_threads(
+    coo_ctx_t* ctx,
+    const int  threads
+);
+
+
+/*!
+ * @brief set gravitational constant of a context
+ * @details the mass parameter of each object is G(M+m), with masses in
+ * the units of the simulation
+ * @param[in,out] ctx conversion context
+ * @param[in] gm gravitational constant G (finite and > 0)
+ * @return 0 for success, 1 for error
+ */
+int coo_ctx_set_gm(
+    coo_ctx_t*   ctx,
+    const double gm
+);
+
+
+/*!
+ * @brief enable or disable NUMA-aware execution of a context
+ * @details with NUMA mode, the threads of the parallel conversion loops are
+ * pinned to the CPUs of the process, grouped by node, so that each node
+ * converts a contiguous range of objects; arrays allocated with
+ * coo_alloc_bodies() and #COO_ALLOC_PREFAULT for the same context are
+ * first-touched with the same partition; every thread, the calling one and
+ * the OpenMP workers, gets its previous affinity back at the end of each
+ * parallel loop
+ * @param[in,out] ctx conversion context
+ * @param[in] enable true to enable, false to disable NUMA mode
+ * @return 0 for success, 1 for error (no topology in /sys, e.g. not Linux)
+ */
+int coo_ctx_set_numa(
+    coo_ctx_t* ctx,
+    const bool enable
+);
+
+
+/*!
+ * @brief number of NUMA nodes used by a context
+ * @param[in] ctx conversion context
+ * @return number of nodes with usable CPUs, 0 if NUMA mode is disabled
+ */
+uint32_t coo_ctx_numa_nodes(const coo_ctx_t* ctx);
+
+
+/*!
+ * @brief status bitmap of the last conversion of a context
+ * @details the bitmap has COO_MASK_WORDS(dim) valid entries, with \a dim of
+ * the last call of coo_ctx_cvt(); it is owned by the context and
+ * overwritten by the next conversion
+ * @param[in] ctx conversion context
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return status bitmap, nullptr if no conversion has been done yet
+ */
+const uint64_t* coo_ctx_mask(
+    const coo_ctx_t* ctx,
+    uint32_t*        nfail
+);
+
+
+/*!
+ * @brief read counters of a context for a conversion mode
+ * @param[in] ctx conversion context
+ * @param[out] stats counters of type #stats_t
+ * @param[in] mode conversion mode from enum #CVT_MODE_e
+ * @return 0 for success, 1 for error
+ */
+int coo_ctx_stats(
+    const coo_ctx_t* ctx,
+    stats_t*         stats,
+    const CVT_MODE_e mode
+);
+
+
+/*!
+ * @brief reset counters of a context for all conversion modes to zero
+ * @param[in,out] ctx conversion context
+ * @return none
+ */
+void coo_ctx_reset_stats(coo_ctx_t* ctx);
+
+
+/*!
+ * @brief perform coordinate conversion with the settings of a context
+ * @details failed objects are recorded in the status bitmap of the
+ * context, see coo_ctx_mask()
+ * @param[in,out] ctx conversion context
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body
+ * @param[in] mode conversion mode from enum #CVT_MODE_e
+ * @return 0 for success, 1 for error
+ */
+int coo_ctx_cvt(
+    coo_ctx_t*     ctx,
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    CVT_MODE_e     mode
+);
+
+
+/*!
+ * @brief coordinate conversion from a source array into a separate
+ * destination array
+ * @details \a src is only read; of \a dst only the output member of
+ * \a mode is written (e.g. dst[].hel for #CVT_HCO2HEL), so several targets
+ * can be produced from one snapshot without copying it first
+ * @param[in,out] ctx conversion context, settings and counters (may be
+ * nullptr for default settings)
+ * @param[out] dst array of type #body_t for output
+ * @param[in] src array of type #body_t for input, must not overlap \a dst
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_oop(
+    coo_ctx_t*                 ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    CVT_MODE_e                 mode,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief re-run the conversion of selected objects in extended precision
+ * @details converts only objects whose bit in \a mask is set, with all
+ * intermediate results in long double (or __float128 if the library is
+ * built with COO_FLOAT128); input and output stay in #body_t. Typical use
+ * is a fast batch with coocvt_mask(), followed by coo_mask_ecc() to add
+ * near-parabolic orbits to the failed objects, and coocvt_refine() on the
+ * resulting mask. Translations (#CVT_BCO2HCO, #CVT_HCO2BCO) are not re-run.
+ * @param[in] ctx conversion context, settings (may be nullptr for default
+ * settings); counters are not updated
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[in,out] mask status bitmap with COO_MASK_WORDS(dim) entries; on
+ * input bit set for each object to convert, on output bit set for each
+ * object that failed again (may be nullptr to convert all objects)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_refine(
+    coo_ctx_t*     ctx,
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    CVT_MODE_e     mode,
+    uint64_t       mask[],
+    uint32_t*      nfail
+);
+
+
+/*!
+ * @brief coordinate conversion for a contiguous range of objects
+ * @details converts objects first ... first + count - 1 (at most up to
+ * \a dim) serially and without locks, so that callers can schedule the
+ * blocks of an array on their own threads, e.g. a C++ execution policy;
+ * ranges starting at distinct multiples of 64 may be converted
+ * concurrently. Only #CVT_HCO2HEL, #CVT_HEL2HCO and #CVT_HEL2HCO_POS are
+ * available, since translations need sums over all objects.
+ * @param[in] ctx conversion context, settings (may be nullptr for default
+ * settings); the number of threads is ignored, counters are not updated
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[in] first index of first object, multiple of 64
+ * @param[in] count number of objects, multiple of 64 unless the range
+ * reaches the end of the array (\a first + \a count >= \a dim), so that
+ * concurrent ranges never share a word of \a mask
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, only the
+ * words of the range are written (may be nullptr)
+ * @param[out] nfail number of failed objects in the range (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_range(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    CVT_MODE_e       mode,
+    const uint32_t   first,
+    const uint32_t   count,
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+
+/*!
+ * @brief coordinate conversion with partial derivatives, using the
+ * settings of a conversion context, and report objects without valid
+ * partials
+ * @details as coocvt_jac(), with the gravitational constant and the number
+ * of threads taken from \a ctx; the bit in \a mask is set for each object
+ * whose Jacobian is set to zero. For #CVT_HCO2HEL these are objects that
+ * fail to convert, nearly circular or planar orbits (e or sin(inc) below
+ * sqrt(DBL_EPSILON), where aph and lan are ill-defined); for #CVT_HEL2HCO
+ * objects with invalid elements, which keep their previous coordinates.
+ * @param[in] ctx conversion context, settings (may be nullptr for default
+ * settings); counters are not updated
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[out] jac array of type #jac_t with \a dim entries
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each object without valid partials (may be nullptr)
+ * @param[out] nfail number of objects without valid partials (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_jac_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    CVT_MODE_e       mode,
+    jac_t            jac[],
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+/*** inline function definitions ***/
+
+/*!
+ * @brief gravitational constant of a context
+ * @param[in] ctx conversion context (may be nullptr)
+ * @return G of \a ctx, Gaussian gravitational constant squared for nullptr
+ */
+static inline double coo_ctx_gm(const coo_ctx_t* ctx)
+{
+    return( (ctx != nullptr) ? ctx->gm : gaussk2 );
+} // end coo_ctx_gm
+
+
+/*!
+ * @brief number of threads for parallel loops of a context
+ * @param[in] ctx conversion context (may be nullptr)
+ * @param[in] def setting for nullptr, 0 = OpenMP default
+ * @return number of threads (> 0), always 1 without OpenMP
+ */
+static inline int coo_ctx_threads(
+    const coo_ctx_t* ctx,
+    const int        def
+    )
+{
+    const int num = (ctx != nullptr) ? ctx->threads : def;
+#ifdef _OPENMP
+    return( (num > 0) ? num : omp_get_max_threads() );
+#else
+    (void)num;
+    return 1;
+#endif
+} // end coo_ctx_threads
+
+
+
+/*!
+ * @brief pin the calling thread of a parallel region in NUMA mode
+ * @param[in] ctx conversion context (may be nullptr)
+ * @return none
+ */
+static inline void coo_ctx_pin(const coo_ctx_t* ctx)
+{
+    if ( (ctx != nullptr) && (ctx->cpus != nullptr) ) coo_numa_pin( ctx );
+} // end coo_ctx_pin
+
+
+/*!
+ * @brief restore the affinity of the calling thread at the end of a parallel
+ * region, to be called by each thread that called coo_ctx_pin()
+ * @param[in] ctx conversion context (may be nullptr)
+ * @return none
+ */
+static inline void coo_ctx_unpin(const coo_ctx_t* ctx)
+{
+    if ( (ctx != nullptr) && (ctx->cpus != nullptr) ) coo_numa_unpin( ctx );
+} // end coo_ctx_unpin
+
+/******************************************************************************/
+
+/*** block driver of the conversion kernels ***/
+
+/* OpenMP pragma with macro-expanded clauses, empty without OpenMP */
+#ifdef _OPENMP
+    #define COO_OMP(x) _Pragma( #x )
+#else
+    #define COO_OMP(x)
+#endif
+
+/*!
+ * @brief convert the objects of one block of 64, matching word \a w of the
+ * status bitmap
+ * @details for each object \a i of the block, except \a center and objects
+ * whose bit in \a sel is clear, the expression \a CONVERT is evaluated and
+ * must give 0 for success or 1 for a failed object; failed objects are
+ * counted in \a nerr
+ * @param[out] bits name of uint64_t variable for the word of the bitmap, bit
+ * set for failed objects
+ * @param[in] w index of block, objects 64 w to 64 w + 63
+ * @param[in] dim dimension of array, end of last block
+ * @param[in] center index of central body, skipped (\a dim for none)
+ * @param[in] sel word of selected objects, ~0 for all
+ * @param[in,out] nerr name of uint32_t counter of failed objects
+ * @param[in] i name of object index, declared by the macro
+ * @param[in] CONVERT conversion of object \a i
+ */
+#define COO_BLOCK_WORD(bits, w, dim, center, sel, nerr, i, CONVERT)        \
+    do {                                                                    \
+        const uint32_t coo_lo_  = (w) * 64u;                                \
+        const uint32_t coo_hi_  = ((dim) - coo_lo_ < 64u)                   \
+                                ? (dim) : coo_lo_ + 64u;                    \
+        const uint64_t coo_sel_ = (sel);                                    \
+        (bits) = 0;                                                         \
+        for (register uint32_t i = coo_lo_; i < coo_hi_; i++)               \
+        {                                                                   \
+            /* skip central object and unselected objects */                \
+            if ( (i == (center)) || !((coo_sel_ >> (i - coo_lo_)) & 1u) )   \
+                continue;                                                   \
+                                                                            \
+            /* record failed conversion */                                  \
+            const uint64_t coo_err_ = (uint64_t)(CONVERT);                  \
+            (bits) |= coo_err_ << (i - coo_lo_);                            \
+            (nerr) += (uint32_t)coo_err_;                                   \
+        }                                                                   \
+    } while (0)
+
+/*!
+ * @brief convert all objects of an array block-wise, distributed over the
+ * threads of a context
+ * @details objects are processed in blocks of 64, matching one word of the
+ * bitmap, so that each word is written only once, see COO_BLOCK_WORD();
+ * each thread is pinned for the loop in NUMA mode of \a ctx, and records
+ * its own begin and end events, named after the calling kernel, if the
+ * tracer is active
+ * @param[in] ctx conversion context (may be nullptr for a serial loop)
+ * @param[in] dim dimension of array
+ * @param[in] center index of central body, skipped (\a dim for none)
+ * @param[in] select whether \a mask selects the objects on input (Boolean)
+ * @param[in,out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit
+ * set for failed objects (may be nullptr)
+ * @param[in,out] nerr name of uint32_t counter of failed objects
+ * @param[in] i name of object index, declared by the macro
+ * @param[in] CONVERT conversion of object \a i, 0 = success, 1 = error
+ */
+#define COO_BLOCK_LOOP(ctx, dim, center, select, mask, nerr, i, CONVERT)   \
+    do {                                                                    \
+        const uint32_t coo_nw_  = COO_MASK_WORDS(dim);                      \
+        const int      coo_thr_ = coo_ctx_threads( (ctx), 1 );              \
+        (void)coo_thr_;                                                     \
+                                                                            \
+        COO_OMP(omp parallel reduction(+:nerr) num_threads(coo_thr_)        \
+                if(coo_thr_ > 1))                                           \
+        {                                                                   \
+            /* pin each thread for the loop, restore its affinity after it */ \
+            coo_ctx_pin( (ctx) );                                           \
+            COO_TRACE_BEGIN( __func__, 0 );                                 \
+                                                                            \
+            /* number of objects of this thread */                          \
+            uint32_t coo_num_ = 0;                                          \
+                                                                            \
+            COO_OMP(omp for schedule(static))                               \
+            for (uint32_t coo_w_ = 0; coo_w_ < coo_nw_; coo_w_++)           \
+            {                                                               \
+                coo_num_ += ((dim) - 64u * coo_w_ < 64u)                    \
+                          ? (dim) - 64u * coo_w_ : 64u;                     \
+                uint64_t coo_bits_;                                         \
+                COO_BLOCK_WORD(                                             \
+                    coo_bits_, coo_w_, (dim), (center),                     \
+                    ((select) && ((mask) != nullptr))                       \
+                        ? (mask)[coo_w_] : ~(uint64_t)0,                    \
+                    nerr, i, CONVERT                                        \
+                );                                                          \
+                                                                            \
+                if ( (mask) != nullptr ) (mask)[coo_w_] = coo_bits_;        \
+            }                                                               \
+                                                                            \
+            COO_TRACE_END( __func__, coo_num_ );                            \
+            coo_ctx_unpin( (ctx) );                                         \
+        }                                                                   \
+    } while (0)
+
+/******************************************************************************/
+
+#endif  /* COO_CONTEXT__H */
@@ -26,10 +26,16 @@
  *
  ******************************************************************************/
 /* include standard headers */
+#include <stdlib.h>
 
 /* include module headers */
 #include "types.h"
 #include "coocvt.h"
+#include "context.h"
+#include "cvtext.h"
+#include "view.h"
+#include "stats.h"
+#include "trace.h"
 
 /******************************************************************************/
 
@@ -43,6 +49,57 @@
 
 /******************************************************************************/
 
+/*** internal constants ***/
+
+/* names of conversion modes for trace events, indexed by CVT_MODE_e */
+static const char* const trace_name[CVT_TOTAL_NUMBER + 1] = {
+    [CVT_NONE]         = "coocvt NONE",
+    [CVT_BCO2HCO]      = "coocvt BCO2HCO",
+    [CVT_HCO2BCO]      = "coocvt HCO2BCO",
+    [CVT_HCO2HEL]      = "coocvt HCO2HEL",
+    [CVT_HEL2HCO]      = "coocvt HEL2HCO",
+    [CVT_HEL2HCO_POS]  = "coocvt HEL2HCO_POS",
+    [CVT_TOTAL_NUMBER] = "coocvt NONE",
+};
+
+/* trace event name for conversion mode, also for invalid modes */
+#define TRACE_NAME(mode)                                    \
+    trace_name[((unsigned)(mode) < CVT_TOTAL_NUMBER)        \
+               ? (mode) : CVT_TOTAL_NUMBER]
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : ctx_stats_add
+ *  DESCRIPTION : add one conversion call to the counters of a context
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - conversion "mode" from enum CVT_MODE_e (valid mode)
+ *                - number "num" of bodies processed
+ *                - number "fail" of bodies that failed to convert
+ *                - time stamp "start" of the call
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void ctx_stats_add(
+    coo_ctx_t*       ctx,
+    const CVT_MODE_e mode,
+    const uint32_t   num,
+    const uint32_t   fail,
+    const uint64_t   start
+    )
+{
+    if ( ctx == nullptr ) return;
+
+    stats_t* const s = &ctx->stats[mode];
+    s->calls  += 1u;
+    s->bodies += num;
+    s->fails  += fail;
+    s->ticks  += coo_stats_ticks() - start;
+
+    return;
+} // end ctx_stats_add
+
+/******************************************************************************/
+
 /*******************************************************************************
  *  FUNCTION    : coocvt
  *  DESCRIPTION : perform coordinate conversion between two sets of coordinates
@@ -64,6 +121,9 @@ int coocvt(
     /* default: no error */
     int ret = 0;
 
+    /* number of failed objects, for runtime counters */
+    uint32_t nfail = 0;
+
     /* check input array */
     if ( obj == nullptr )
     {
@@ -72,12 +132,16 @@ int coocvt(
     } // end if
 
     /* check input indices */
-    if ( dim < center )
+    if ( dim <= center )
     {
         /* TODO print error message */
         return 1;
     } // end if
 
+    /* start timer for runtime counters */
+    const uint64_t start = COO_STATS_TICKS();
+    COO_TRACE_BEGIN( TRACE_NAME(mode), dim );
+
     /* select which conversion "mode" to apply */
     switch ( mode )
     {
@@ -90,11 +154,15 @@ int coocvt(
             break;
 
         case CVT_HCO2HEL:
-            ret = hco2hel( obj, dim, center );
+            ret = hco2hel_ex( obj, dim, center, nullptr, &nfail );
             break;
 
         case CVT_HEL2HCO:
-            ret = hel2hco( obj, dim, center );
+            ret = hel2hco_ex( obj, dim, center, nullptr, &nfail );
+            break;
+
+        case CVT_HEL2HCO_POS:
+            ret = hel2hco_pos_ex( obj, dim, center, nullptr, &nfail );
             break;
 
         /* D'OH, don't know what to do ... */
@@ -106,7 +174,690 @@ int coocvt(
             break;
     } // end switch
 
+    /* update runtime counters */
+    COO_STATS_ADD( mode, dim, nfail, start );
+    COO_TRACE_END( TRACE_NAME(mode), dim );
+
     return ret;
 } // end coocvt
 
 /******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coocvt_mask
+ *  DESCRIPTION : perform coordinate conversion between two sets of coordinates
+ *                and report objects that failed to convert
+ *  INPUT       : - pointer "obj" to array of type body_t
+ *                - dimension "dim" of array "obj"
+ *                - index "center" of central body
+ *                - conversion "mode" specifying the types of input and output
+ *                  coordinates, take values from enum cvt_mode_e
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coocvt_mask(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    CVT_MODE_e     mode,
+    uint64_t       mask[],
+    uint32_t*      nfail
+    )
+{
+    /* check input array */
+    if ( obj == nullptr )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* check input indices */
+    if ( dim <= center )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* number of failed objects, for runtime counters */
+    uint32_t nerr = 0;
+    int      ret  = 0;
+
+    /* start timer for runtime counters */
+    const uint64_t start = COO_STATS_TICKS();
+
+    /* select which conversion "mode" to apply */
+    switch ( mode )
+    {
+        case CVT_HCO2HEL:
+            COO_TRACE_BEGIN( TRACE_NAME(mode), dim );
+            ret = hco2hel_ex( obj, dim, center, mask, &nerr );
+            if ( nfail != nullptr ) *nfail = nerr;
+            COO_STATS_ADD( mode, dim, nerr, start );
+            COO_TRACE_END( TRACE_NAME(mode), dim );
+            return ret;
+
+        case CVT_HEL2HCO:
+            COO_TRACE_BEGIN( TRACE_NAME(mode), dim );
+            ret = hel2hco_ex( obj, dim, center, mask, &nerr );
+            if ( nfail != nullptr ) *nfail = nerr;
+            COO_STATS_ADD( mode, dim, nerr, start );
+            COO_TRACE_END( TRACE_NAME(mode), dim );
+            return ret;
+
+        case CVT_HEL2HCO_POS:
+            COO_TRACE_BEGIN( TRACE_NAME(mode), dim );
+            ret = hel2hco_pos_ex( obj, dim, center, mask, &nerr );
+            if ( nfail != nullptr ) *nfail = nerr;
+            COO_STATS_ADD( mode, dim, nerr, start );
+            COO_TRACE_END( TRACE_NAME(mode), dim );
+            return ret;
+
+        /* translations never fail for single objects */
+        case CVT_BCO2HCO:
+        case CVT_HCO2BCO:
+            if ( mask != nullptr )
+            {
+                for (register uint32_t w = 0; w < COO_MASK_WORDS(dim); w++)
+                {
+                    mask[w] = 0;
+                } // end for
+            } // end if
+            if ( nfail != nullptr ) *nfail = 0;
+            return coocvt( obj, dim, center, mode );
+
+        /* D'OH, don't know what to do ... */
+        case CVT_NONE:
+        case CVT_TOTAL_NUMBER:
+        default:
+            /* TODO print error message */
+            return 1;
+    } // end switch
+} // end coocvt_mask
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coocvt_view_oop
+ *  DESCRIPTION : perform coordinate conversion between caller-owned buffers
+ *                and report objects that failed to convert
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" of type view_t for output columns
+ *                - pointer "src" of type view_t for input columns, may be
+ *                  equal to "dst" for in-place conversion
+ *                - index "center" of central body
+ *                - conversion "mode" specifying the types of input and output
+ *                  coordinates, take values from enum cvt_mode_e
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 for success, 1 for error
+ *  NOTE        : only conversions between heliocentric coordinates and
+ *                elements are available; counters of "ctx" are updated
+ ******************************************************************************/
+int coocvt_view_oop(
+    coo_ctx_t*          ctx,
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      center,
+    CVT_MODE_e          mode,
+    uint64_t            mask[],
+    uint32_t*           nfail
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    const uint32_t dim = src->dim;
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+    int      ret  = 0;
+
+    /* start timer for counters */
+    const uint64_t start = coo_stats_ticks();
+    COO_TRACE_BEGIN( TRACE_NAME(mode), dim );
+
+    /* select which conversion "mode" to apply */
+    switch ( mode )
+    {
+        case CVT_HCO2HEL:
+            ret = hco2hel_view( ctx, dst, src, center, mask, &nerr );
+            break;
+
+        case CVT_HEL2HCO:
+            ret = hel2hco_view( ctx, dst, src, center, mask, &nerr );
+            break;
+
+        case CVT_HEL2HCO_POS:
+            ret = hel2hco_pos_view( ctx, dst, src, center, mask, &nerr );
+            break;
+
+        /* views hold no barycentric coordinates */
+        case CVT_BCO2HCO:
+        case CVT_HCO2BCO:
+        /* D'OH, don't know what to do ... */
+        case CVT_NONE:
+        case CVT_TOTAL_NUMBER:
+        default:
+            /* TODO print error message */
+            COO_TRACE_END( TRACE_NAME(mode), dim );
+            return 1;
+    } // end switch
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    /* update counters of context, and process-wide runtime counters */
+    ctx_stats_add( ctx, mode, dim, nerr, start );
+    COO_STATS_ADD( mode, dim, nerr, start );
+    COO_TRACE_END( TRACE_NAME(mode), dim );
+
+    return ret;
+} // end coocvt_view_oop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coocvt_view
+ *  DESCRIPTION : perform coordinate conversion in caller-owned memory
+ *                and report objects that failed to convert
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "view" of type view_t to caller-owned data
+ *                - index "center" of central body
+ *                - conversion "mode" specifying the types of input and output
+ *                  coordinates, take values from enum cvt_mode_e
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coocvt_view(
+    coo_ctx_t*          ctx,
+    const view_t* const view,
+    const uint32_t      center,
+    CVT_MODE_e          mode,
+    uint64_t            mask[],
+    uint32_t*           nfail
+    )
+{
+    return( coocvt_view_oop( ctx, view, view, center, mode, mask, nfail ) );
+} // end coocvt_view
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coocvt_oop
+ *  DESCRIPTION : perform coordinate conversion from a source array into a
+ *                separate destination array
+ *                and report objects that failed to convert
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" to array of type body_t for output, only
+ *                  the output member of "mode" is written
+ *                - pointer "src" to array of type body_t for input, must
+ *                  not overlap with "dst"
+ *                - dimension "dim" of arrays
+ *                - index "center" of central body
+ *                - conversion "mode" specifying the types of input and output
+ *                  coordinates, take values from enum cvt_mode_e
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coocvt_oop(
+    coo_ctx_t*                 ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    CVT_MODE_e                 mode,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+    int      ret  = 0;
+
+    /* start timer for counters */
+    const uint64_t start = coo_stats_ticks();
+    COO_TRACE_BEGIN( TRACE_NAME(mode), dim );
+
+    /* select which conversion "mode" to apply */
+    switch ( mode )
+    {
+        /* translations never fail for single objects */
+        case CVT_BCO2HCO:
+            ret = bco2hco_oop( dst, src, dim, center );
+            if ( mask != nullptr )
+            {
+                for (register uint32_t w = 0; w < COO_MASK_WORDS(dim); w++)
+                {
+                    mask[w] = 0;
+                } // end for
+            } // end if
+            break;
+
+        case CVT_HCO2BCO:
+            ret = hco2bco_oop( ctx, dst, src, dim, center );
+            if ( mask != nullptr )
+            {
+                for (register uint32_t w = 0; w < COO_MASK_WORDS(dim); w++)
+                {
+                    mask[w] = 0;
+                } // end for
+            } // end if
+            break;
+
+        case CVT_HCO2HEL:
+            ret = hco2hel_oop( ctx, dst, src, dim, center, mask, &nerr );
+            break;
+
+        case CVT_HEL2HCO:
+            ret = hel2hco_oop( ctx, dst, src, dim, center, mask, &nerr );
+            break;
+
+        case CVT_HEL2HCO_POS:
+            ret = hel2hco_pos_oop( ctx, dst, src, dim, center, mask, &nerr );
+            break;
+
+        /* D'OH, don't know what to do ... */
+        case CVT_NONE:
+        case CVT_TOTAL_NUMBER:
+        default:
+            /* TODO print error message */
+            COO_TRACE_END( TRACE_NAME(mode), dim );
+            return 1;
+    } // end switch
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    /* update counters of context, and process-wide runtime counters */
+    ctx_stats_add( ctx, mode, dim, nerr, start );
+    COO_STATS_ADD( mode, dim, nerr, start );
+    COO_TRACE_END( TRACE_NAME(mode), dim );
+
+    return ret;
+} // end coocvt_oop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coocvt_refine
+ *  DESCRIPTION : re-run the conversion of selected objects in extended
+ *                precision, e.g. of objects that failed or were flagged as
+ *                ill-conditioned by a double-precision batch
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t
+ *                - dimension "dim" of array "obj"
+ *                - index "center" of central body
+ *                - conversion "mode" specifying the types of input and output
+ *                  coordinates, take values from enum cvt_mode_e
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries; on input bit set for objects to convert, on
+ *                  output bit set for objects that failed again (may be
+ *                  nullptr to convert all objects)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 for success, 1 for error
+ *  NOTE        : translations are exact up to rounding of the sums and are
+ *                not re-run; runtime counters are not updated
+ ******************************************************************************/
+int coocvt_refine(
+    coo_ctx_t*     ctx,
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    CVT_MODE_e     mode,
+    uint64_t       mask[],
+    uint32_t*      nfail
+    )
+{
+    /* check input */
+    if ( (obj == nullptr) || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+    int      ret  = 0;
+
+    COO_TRACE_BEGIN( TRACE_NAME(mode), dim );
+
+    /* select which conversion "mode" to apply */
+    switch ( mode )
+    {
+        case CVT_HCO2HEL:
+            ret = hco2hel_refine( ctx, obj, dim, center, mask, &nerr );
+            break;
+
+        case CVT_HEL2HCO:
+            ret = hel2hco_refine( ctx, obj, dim, center, mask, &nerr );
+            break;
+
+        case CVT_HEL2HCO_POS:
+            ret = hel2hco_pos_refine( ctx, obj, dim, center, mask, &nerr );
+            break;
+
+        /* translations never fail for single objects */
+        case CVT_BCO2HCO:
+        case CVT_HCO2BCO:
+            if ( mask != nullptr )
+            {
+                for (register uint32_t w = 0; w < COO_MASK_WORDS(dim); w++)
+                {
+                    mask[w] = 0;
+                } // end for
+            } // end if
+            break;
+
+        /* D'OH, don't know what to do ... */
+        case CVT_NONE:
+        case CVT_TOTAL_NUMBER:
+        default:
+            /* TODO print error message */
+            COO_TRACE_END( TRACE_NAME(mode), dim );
+            return 1;
+    } // end switch
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    COO_TRACE_END( TRACE_NAME(mode), dim );
+
+    return ret;
+} // end coocvt_refine
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coocvt_range
+ *  DESCRIPTION : perform coordinate conversion for a contiguous range of
+ *                objects of an array, and report objects that failed to
+ *                convert
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t
+ *                - dimension "dim" of array "obj"
+ *                - index "center" of central body
+ *                - conversion "mode" specifying the types of input and output
+ *                  coordinates, take values from enum cvt_mode_e
+ *                - index "first" of first object, multiple of 64
+ *                - number "count" of objects, multiple of 64 unless the
+ *                  range reaches the end of the array (first+count >= dim)
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, only the words of the range are written
+ *                  (may be nullptr)
+ *                - pointer "nfail" for number of failed objects in the range
+ *                  (may be nullptr)
+ *  OUTPUT      : 0 for success, 1 for error
+ *  NOTE        : building block for callers that schedule the blocks of an
+ *                array on their own threads: the range is converted
+ *                serially, without locks, and ranges starting at distinct
+ *                multiples of 64 may be converted concurrently; only
+ *                conversions between heliocentric coordinates and elements
+ *                are available, since translations need sums over all
+ *                objects; counters and tracer are not updated
+ ******************************************************************************/
+int coocvt_range(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    CVT_MODE_e       mode,
+    const uint32_t   first,
+    const uint32_t   count,
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
+{
+    /* select which conversion "mode" to apply */
+    switch ( mode )
+    {
+        case CVT_HCO2HEL:
+            return hco2hel_range(
+                ctx, obj, dim, center, first, count, mask, nfail
+            );
+
+        case CVT_HEL2HCO:
+            return hel2hco_range(
+                ctx, obj, dim, center, first, count, mask, nfail, true
+            );
+
+        case CVT_HEL2HCO_POS:
+            return hel2hco_range(
+                ctx, obj, dim, center, first, count, mask, nfail, false
+            );
+
+        /* translations and invalid modes */
+        case CVT_BCO2HCO:
+        case CVT_HCO2BCO:
+        case CVT_NONE:
+        case CVT_TOTAL_NUMBER:
+        default:
+            /* TODO print error message */
+            return 1;
+    } // end switch
+} // end coocvt_range
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_ctx_cvt
+ *  DESCRIPTION : perform coordinate conversion between two sets of coordinates
+ *                with the settings of a conversion context
+ *  INPUT       : - pointer "ctx" to conversion context
+ *                - pointer "obj" to array of type body_t
+ *                - dimension "dim" of array "obj"
+ *                - index "center" of central body
+ *                - conversion "mode" specifying the types of input and output
+ *                  coordinates, take values from enum cvt_mode_e
+ *  OUTPUT      : 0 for success, 1 for error
+ *  NOTE        : failed objects are recorded in the status bitmap of "ctx",
+ *                the counters of "ctx" are updated for valid modes
+ ******************************************************************************/
+int coo_ctx_cvt(
+    coo_ctx_t*     ctx,
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    CVT_MODE_e     mode
+    )
+{
+    /* check input */
+    if ( (ctx == nullptr) || (obj == nullptr) || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* grow status bitmap of context, if necessary */
+    const uint32_t nwords = COO_MASK_WORDS(dim);
+    if ( nwords > ctx->mask_words )
+    {
+        uint64_t* buf = realloc( ctx->mask, (size_t)nwords * sizeof(uint64_t) );
+        if ( buf == nullptr )
+        {
+            /* TODO print error message */
+            return 1;
+        } // end if
+        ctx->mask       = buf;
+        ctx->mask_words = nwords;
+    } // end if
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+    int      ret  = 0;
+
+    /* start timer for counters */
+    const uint64_t start = coo_stats_ticks();
+    COO_TRACE_BEGIN( TRACE_NAME(mode), dim );
+
+    /* select which conversion "mode" to apply */
+    switch ( mode )
+    {
+        /* translations never fail for single objects */
+        case CVT_BCO2HCO:
+            ret = bco2hco( obj, dim, center );
+            for (register uint32_t w = 0; w < nwords; w++) ctx->mask[w] = 0;
+            break;
+
+        case CVT_HCO2BCO:
+            ret = hco2bco_ctx( ctx, obj, dim, center );
+            for (register uint32_t w = 0; w < nwords; w++) ctx->mask[w] = 0;
+            break;
+
+        case CVT_HCO2HEL:
+            ret = hco2hel_ctx( ctx, obj, dim, center, ctx->mask, &nerr );
+            break;
+
+        case CVT_HEL2HCO:
+            ret = hel2hco_ctx( ctx, obj, dim, center, ctx->mask, &nerr );
+            break;
+
+        case CVT_HEL2HCO_POS:
+            ret = hel2hco_pos_ctx( ctx, obj, dim, center, ctx->mask, &nerr );
+            break;
+
+        /* D'OH, don't know what to do ... */
+        case CVT_NONE:
+        case CVT_TOTAL_NUMBER:
+        default:
+            /* TODO print error message */
+            COO_TRACE_END( TRACE_NAME(mode), dim );
+            return 1;
+    } // end switch
+
+    ctx->nfail = nerr;
+
+    /* update counters of context, and process-wide runtime counters */
+    ctx_stats_add( ctx, mode, dim, nerr, start );
+    COO_STATS_ADD( mode, dim, nerr, start );
+    COO_TRACE_END( TRACE_NAME(mode), dim );
+
+    return ret;
+} // end coo_ctx_cvt
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coocvt_jac
+ *  DESCRIPTION : perform coordinate conversion between two sets of coordinates
+ *                and return the matrix of partial derivatives for each object
+ *  INPUT       : - pointer "obj" to array of type body_t
+ *                - dimension "dim" of array "obj"
+ *                - index "center" of central body
+ *                - conversion "mode" specifying the types of input and output
+ *                  coordinates, take values from enum cvt_mode_e
+ *                - pointer "jac" to array of type jac_t with "dim" entries
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coocvt_jac(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    CVT_MODE_e     mode,
+    jac_t          jac[]
+    )
+{
+    /* check input arrays */
+    if ( (obj == nullptr) || (jac == nullptr) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* check input indices */
+    if ( dim <= center )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* select which conversion "mode" to apply */
+    switch ( mode )
+    {
+        case CVT_HCO2HEL:
+            return hco2hel_jac( obj, dim, center, jac );
+
+        case CVT_HEL2HCO:
+            return hel2hco_jac( obj, dim, center, jac );
+
+        /* partials only available for conversions between HCO and HEL */
+        case CVT_NONE:
+        case CVT_BCO2HCO:
+        case CVT_HCO2BCO:
+        case CVT_HEL2HCO_POS:
+        case CVT_TOTAL_NUMBER:
+        default:
+            /* TODO print error message */
+            return 1;
+    } // end switch
+} // end coocvt_jac
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coocvt_jac_ctx
+ *  DESCRIPTION : perform coordinate conversion between two sets of coordinates
+ *                with the settings of a conversion context, return the
+ *                matrix of partial derivatives for each object, and report
+ *                objects without valid partials
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t
+ *                - dimension "dim" of array "obj"
+ *                - index "center" of central body
+ *                - conversion "mode" specifying the types of input and output
+ *                  coordinates, take values from enum cvt_mode_e
+ *                - pointer "jac" to array of type jac_t with "dim" entries
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries (may be nullptr)
+ *                - pointer "nfail" for number of flagged objects (may be
+ *                  nullptr)
+ *  OUTPUT      : 0 for success, 1 for error
+ *  NOTE        : runtime counters are not updated
+ ******************************************************************************/
+int coocvt_jac_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    CVT_MODE_e       mode,
+    jac_t            jac[],
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
+{
+    /* select which conversion "mode" to apply */
+    switch ( mode )
+    {
+        case CVT_HCO2HEL:
+            return hco2hel_jac_ctx( ctx, obj, dim, center, jac, mask, nfail );
+
+        case CVT_HEL2HCO:
+            return hel2hco_jac_ctx( ctx, obj, dim, center, jac, mask, nfail );
+
+        /* partials only available for conversions between HCO and HEL */
+        case CVT_NONE:
+        case CVT_BCO2HCO:
+        case CVT_HCO2BCO:
+        case CVT_HEL2HCO_POS:
+        case CVT_TOTAL_NUMBER:
+        default:
+            /* TODO print error message */
+            return 1;
+    } // end switch
+} // end coocvt_jac_ctx
+
+/******************************************************************************/
@@ -67,6 +67,9 @@ typedef enum
     CVT_HCO2HEL, // heliocentric coord. to heliocentric elem.
     CVT_HEL2HCO, // heliocentric elem.  to heliocentric coord.
 
+    /* special conversion modes */
+    CVT_HEL2HCO_POS, // heliocentric elem. to heliocentric positions only
+
     /* total number of available modes */
     CVT_TOTAL_NUMBER
 } CVT_MODE_e;
@@ -0,0 +1,142 @@
+/***************************************************************************//**
+ * @file    csum.h
+ * @brief   compensated summation helpers for Coordinate Conversion Library
+ * @details internal header, not part of the public API
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_CSUM__H
+#define COO_CSUM__H
+
+/******************************************************************************/
+
+/*** include prerequisite headers ***/
+
+/* include standard headers */
+#include <math.h>
+
+/******************************************************************************/
+
+/*** define pre-processor constants ***/
+
+/*!
+ * @brief number of independent accumulators (lanes) for array reductions
+ * @details independent lanes break the serial dependency of the running sum,
+ * so that the compiler can pipeline or vectorize the lane updates
+ */
+#define CSUM_LANES 4
+
+/******************************************************************************/
+
+/*** inline function definitions ***/
+
+/*!
+ * @brief add value to a compensated running sum
+ * @details Kahan-Babuska-Neumaier summation, the rounding error of each
+ * addition is accumulated in \a err; works for values of either sign,
+ * so it is also used for removing previously added values
+ * @note don't compile with gcc -ffast-math or -funsafe-math-optimizations
+ * @param[in,out] sum running sum
+ * @param[in,out] err running compensation term
+ * @param[in] x value to add
+ * @return none
+ */
+static inline void csum_add(
+    double*      sum,
+    double*      err,
+    const double x
+    )
+{
+    const double t = *sum + x;
+    if ( fabs(*sum) >= fabs(x) )
+    {
+        *err += (*sum - t) + x;
+    } // end if
+    else
+    {
+        *err += (x - t) + *sum;
+    } // end else
+    *sum = t;
+} // end csum_add
+
+
+/*!
+ * @brief return the value of a compensated running sum
+ * @param[in] sum running sum
+ * @param[in] err running compensation term
+ * @return compensated sum
+ */
+static inline double csum_get(
+    const double sum,
+    const double err
+    )
+{
+    return( sum + err );
+} // end csum_get
+
+
+
+/*!
+ * @brief add value to a compensated running sum, branch-free version
+ * @details Knuth's TwoSum gives the exact rounding error of each addition
+ * without comparing magnitudes, which allows vectorization of lane updates
+ * @note don't compile with gcc -ffast-math or -funsafe-math-optimizations
+ * @param[in,out] sum running sum
+ * @param[in,out] err running compensation term
+ * @param[in] x value to add
+ * @return none
+ */
+static inline void csum_twosum(
+    double*      sum,
+    double*      err,
+    const double x
+    )
+{
+    const double s  = *sum + x;
+    const double bp = s - *sum;
+    *err += (*sum - (s - bp)) + (x - bp);
+    *sum  = s;
+} // end csum_twosum
+
+
+/*!
+ * @brief merge two compensated running sums
+ * @param[in,out] sum first running sum, receives the result
+ * @param[in,out] err first compensation term, receives the result
+ * @param[in] sum2 second running sum
+ * @param[in] err2 second compensation term
+ * @return none
+ */
+static inline void csum_merge(
+    double*      sum,
+    double*      err,
+    const double sum2,
+    const double err2
+    )
+{
+    csum_twosum( sum, err, sum2 );
+    *err += err2;
+} // end csum_merge
+
+/******************************************************************************/
+
+#endif  /* COO_CSUM__H */
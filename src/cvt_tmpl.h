@@ -0,0 +1,521 @@
+/***************************************************************************//**
+ * @file    cvt_tmpl.h
+ * @brief   type-generic template of the Kepler solver and of the conversions
+ *          between heliocentric coordinates and elements
+ * @details single implementation of these algorithms: the kernels in
+ *          double (cvt_tmpl_d.h), single (cvtfloat.c) and extended precision
+ *          (cvtext.c) and the templates of libcoocvt.hpp are instances of
+ *          this file, and differ only in types and elementary functions;
+ *          there is deliberately no include guard: the header is included
+ *          once per floating-point type, after defining the following macros
+ *          (all of them are undefined again at the end of this file)
+ *          - TMPL_FN(name)  name of generated function, e.g. name##_f
+ *          - TMPL_ST        scalar type of stored coordinates and elements
+ *          - TMPL_HCO       structure for coordinates, components of TMPL_ST
+ *          - TMPL_HEL       structure for elements, components of TMPL_ST
+ *          - TMPL_CT        scalar type for arithmetic of the conversions
+ *          - TMPL_CM(fn)    name of libm function fn for TMPL_CT, e.g. fn##f
+ *          - TMPL_CL(x)     floating-point literal x of type TMPL_CT
+ *          - TMPL_KT        scalar type for the Kepler solver
+ *          - TMPL_KM(fn)    name of libm function fn for TMPL_KT
+ *          - TMPL_KL(x)     floating-point literal x of type TMPL_KT
+ *          - TMPL_KITER     number of extra iteration passes of the Kepler
+ *                           solver, 0 for types up to double precision
+ *          - TMPL_LINKAGE   optional, storage class of generated functions,
+ *                           default "static inline"
+ *          - TMPL_ATAN2     optional, replacement for TMPL_CM(atan2), e.g.
+ *                           an inline approximation from fastmath.h
+ *          - TMPL_HYPOT     optional, replacement for the norm
+ *                           TMPL_CM(sqrt)(x*x + y*y), e.g. coo_hypot()
+ *          - TMPL_CBRT      optional, replacement for TMPL_KM(cbrt)
+ *          - TMPL_KSOLVE    optional, replacement for tm_kesolver() in the
+ *                           conversions, e.g. coo_kesolver() for TMPL_KT
+ *                           double
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+/*** include prerequisite headers ***/
+
+/* include standard headers */
+#ifndef __cplusplus
+    #include <stdbool.h>
+#endif
+
+/******************************************************************************/
+
+/*** define pre-processor constants ***/
+
+#if !defined(TMPL_FN) || !defined(TMPL_ST) || !defined(TMPL_HCO) \
+    || !defined(TMPL_HEL) || !defined(TMPL_CT) || !defined(TMPL_CM) \
+    || !defined(TMPL_CL) || !defined(TMPL_KT) || !defined(TMPL_KM) \
+    || !defined(TMPL_KL) || !defined(TMPL_KITER)
+    #error "cvt_tmpl.h: template parameters TMPL_* not defined"
+#endif
+
+/* storage class of generated functions */
+#ifndef TMPL_LINKAGE
+    #define TMPL_LINKAGE static inline
+#endif
+
+/* arc tangent of y/x, and norm of (x, y), for conversions */
+#ifndef TMPL_ATAN2
+    #define TMPL_ATAN2 TMPL_CM(atan2)
+#endif
+#ifndef TMPL_HYPOT
+    #define TMPL_HYPOT(x,y) TMPL_CM(sqrt)( (x) * (x) + (y) * (y) )
+#endif
+
+/* cube root for Kepler solver */
+#ifndef TMPL_CBRT
+    #define TMPL_CBRT TMPL_KM(cbrt)
+#endif
+
+/* solver of Kepler's Equation for conversions */
+#ifndef TMPL_KSOLVE
+    #define TMPL_KSOLVE TMPL_FN(tm_kesolver)
+#endif
+
+/* pi and 2 pi in precision of Kepler solver and conversions */
+#define TM_KPI  TMPL_KL(3.14159265358979323846264338327950288)
+#define TM_K2PI TMPL_KL(6.28318530717958647692528676655900577)
+#define TM_C2PI TMPL_CL(6.28318530717958647692528676655900577)
+
+/******************************************************************************/
+
+/*** inline function definitions ***/
+
+/*!
+ * @brief reduce angle x by mod(2 pi) to interval -pi <= x < pi
+ * @param[in] x angle in radians
+ * @return reduced angle
+ */
+TMPL_LINKAGE TMPL_KT TMPL_FN(tm_reduce)(TMPL_KT x)
+{
+    x -= TMPL_KM(floor)(x / TM_K2PI) * TM_K2PI;
+    if (x >  TM_KPI) x -= TM_K2PI;
+    if (x < -TM_KPI) x += TM_K2PI;
+    return( x );
+} // end tm_reduce
+
+
+/*!
+ * @brief evaluate sin(x), cos(x) simultaneously, see coo_sincos()
+ * @param[out] sx pointer for ecc*sin(x), or sin(x) if ecc < 0
+ * @param[out] cx pointer for ecc*cos(x), or cos(x) if ecc < 0
+ * @param[in] x angle in radians
+ * @param[in] ecc eccentricity
+ * @return none
+ */
+TMPL_LINKAGE void TMPL_FN(tm_sincos)(
+    TMPL_KT*      sx,
+    TMPL_KT*      cx,
+    const TMPL_KT x,
+    const TMPL_KT ecc
+    )
+{
+    const TMPL_KT tx  = TMPL_KM(tan)(TMPL_KL(0.5) * x);
+    const TMPL_KT den = TMPL_KL(1.0) / (TMPL_KL(1.0) + tx * tx);
+
+    *cx = (TMPL_KL(1.0) - tx * tx) * den;
+    *sx = TMPL_KL(2.0) * tx * den;
+
+    /* multiply by eccentricity ? */
+    if ( ecc >= TMPL_KL(0.0) )
+    {
+        *cx *= ecc;
+        *sx *= ecc;
+    } // end if
+} // end tm_sincos
+
+
+/*!
+ * @brief single pass of the quintic iteration of Danby-Burkardt (1983)
+ * @param[in] ecc eccentricity 0 <= ecc < 1
+ * @param[in] ma mean anomaly 0 <= ma < pi in radians
+ * @param[in] x initial guess for eccentric anomaly in radians
+ * @return iterated value of eccentric anomaly
+ */
+TMPL_LINKAGE TMPL_KT TMPL_FN(tm_itercore)(
+    const TMPL_KT ecc,
+    const TMPL_KT ma,
+    const TMPL_KT x
+    )
+{
+    TMPL_KT ecosx, esinx, dx;
+
+    TMPL_FN(tm_sincos)( &esinx, &ecosx, x, ecc );
+
+    /* Kepler Equation and its (scaled) derivatives */
+    const TMPL_KT f0 = ma - x + esinx;
+    const TMPL_KT f1 = TMPL_KL(1.0) - ecosx + TMPL_KL(1.0e-19);
+    const TMPL_KT f2 = esinx / TMPL_KL(2.0);
+    const TMPL_KT f3 = ecosx / TMPL_KL(6.0);
+    const TMPL_KT f4 = -esinx / TMPL_KL(24.0);
+
+    /* Newton-Raphson, Halley, Danby-Burkardt of 4th and 5th order */
+    dx = f0 / f1;
+    dx = f0 / (f1 + f2 * dx);
+    dx = f0 / (f1 + f2 * dx + f3 * dx * dx);
+    dx = f0 / (f1 + f2 * dx + f3 * dx * dx + f4 * dx * dx * dx);
+
+    return( x + dx );
+} // end tm_itercore
+
+
+/*!
+ * @brief Kepler solver with starter of Markley (1995), see coo_kesolver()
+ * @details TMPL_KITER further passes of tm_itercore() are applied for types
+ * with more than double precision, where the quintic correction of the
+ * starter alone leaves an error of order 1e-16
+ * @param[in] ecc eccentricity 0 <= ecc < 1
+ * @param[in] ma mean anomaly in radians, any real number
+ * @return eccentric anomaly in radians, 0 <= E < 2 pi
+ */
+TMPL_LINKAGE TMPL_KT TMPL_FN(tm_kesolver)(
+    const TMPL_KT ecc,
+    const TMPL_KT ma
+    )
+{
+    /* reduce mean anomaly to -pi <= M < pi, solve for positive M */
+    const TMPL_KT mr  = TMPL_FN(tm_reduce)(ma);
+    const TMPL_KT m   = TMPL_KM(fabs)(mr);
+
+    /* starter from Pade approximation, Markley (1995) eqs.(5-15,20) */
+    const TMPL_KT pi2 = TM_KPI * TM_KPI;
+    const TMPL_KT tmp = TMPL_KL(1.0) / (pi2 - TMPL_KL(6.0));
+    const TMPL_KT ad  = TMPL_KL(3.0) * pi2 * tmp;
+    const TMPL_KT ak  = TMPL_KL(1.6) * TM_KPI * tmp;
+    const TMPL_KT a   = ad + ak * (TM_KPI - m) / (TMPL_KL(1.0) + ecc);
+    const TMPL_KT d   = TMPL_KL(3.0) * (TMPL_KL(1.0) - ecc) + a * ecc;
+    const TMPL_KT q   = TMPL_KL(2.0) * a * d * (TMPL_KL(1.0) - ecc) - m * m;
+    const TMPL_KT r   = TMPL_KL(3.0) * a * d * (d - TMPL_KL(1.0) + ecc) * m
+                      + m * m * m;
+    TMPL_KT       w   = TMPL_CBRT(
+        TMPL_KM(fabs)(r) + TMPL_KM(sqrt)(q * q * q + r * r)
+    );
+    w                *= w;
+
+    TMPL_KT x = TMPL_KL(0.0);
+    if ( w > TMPL_KL(0.0) )
+    {
+        x = (TMPL_KL(2.0) * r * w / (w * w + q * w + q * q) + m) / d;
+    } // end if
+
+    /* 5th order correction, Markley (1995) eq.(24), and extra passes */
+    x = TMPL_FN(tm_itercore)(ecc, m, x);
+    for (int k = 0; k < TMPL_KITER; k++)
+    {
+        x = TMPL_FN(tm_itercore)(ecc, m, x);
+    } // end for
+
+    return( (mr < TMPL_KL(0.0)) ? TM_K2PI - x : x );
+} // end tm_kesolver
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements for a
+ * single object, see hco2hel_ctx()
+ * @details coordinates are read into and elements computed in TMPL_CT;
+ * the eccentricity is checked after rounding to TMPL_ST, so that all
+ * stored elements are valid input for the kernels of that type
+ * @param[out] ele resulting elements, only written on success
+ * @param[in] coo source coordinates
+ * @param[in] mu mass parameter mu = G (m0 + m)
+ * @param[out] ean eccentric anomaly, for the partials (may be nullptr)
+ * @return 0 = success, 1 = error (a <= 0 or e >= 1)
+ */
+TMPL_LINKAGE int TMPL_FN(tm_hco2hel_core)(
+    TMPL_HEL*             ele,
+    const TMPL_HCO* const coo,
+    const TMPL_CT         mu,
+    TMPL_CT* const        ean
+    )
+{
+    const TMPL_CT x  = coo->pos.x;
+    const TMPL_CT y  = coo->pos.y;
+    const TMPL_CT z  = coo->pos.z;
+
+    /* normalised velocity: vel / (mu)^1/2 */
+    const TMPL_CT vs = TMPL_CL(1.0) / TMPL_CM(sqrt)( mu );
+    const TMPL_CT vx = coo->vel.x * vs;
+    const TMPL_CT vy = coo->vel.y * vs;
+    const TMPL_CT vz = coo->vel.z * vs;
+
+    /* absolute value of position vector */
+    const TMPL_CT pabs = TMPL_CM(sqrt)( x * x + y * y + z * z );
+
+    /* specific angular momentum: r x v */
+    const TMPL_CT hx   = y * vz - z * vy;
+    const TMPL_CT hy   = z * vx - x * vz;
+    const TMPL_CT hz   = x * vy - y * vx;
+    const TMPL_CT habs = TMPL_CM(sqrt)( hx * hx + hy * hy + hz * hz );
+
+    /* semi-major axis: 1 / a = 2 / |r| - |v|^2 */
+    const TMPL_CT inva = (TMPL_CL(2.0) / pabs) - (vx * vx + vy * vy + vz * vz);
+    if ( !(inva > TMPL_CL(0.0)) ) return 1;
+
+    /* components of eccentric anomaly, and eccentricity; NaN fails */
+    const TMPL_CT ecosE = TMPL_CL(1.0) - pabs * inva;
+    const TMPL_CT esinE = (x * vx + y * vy + z * vz) * TMPL_CM(sqrt)( inva );
+    const TMPL_CT ecc   = TMPL_HYPOT( esinE, ecosE );
+    const TMPL_ST ecc_s = (TMPL_ST)ecc;
+    if ( !(ecc_s >= 0) || (ecc_s >= 1) ) return 1;
+
+    /* inclination, longitude of ascending node, argument of latitude */
+    TMPL_CT inc = TMPL_ATAN2( TMPL_HYPOT( hx, hy ), hz );
+    TMPL_CT lan = TMPL_ATAN2( hx, -hy );
+    const TMPL_CT u = TMPL_ATAN2( z * habs, y * hx - x * hy );
+
+    /* eccentric and mean anomaly, true anomaly, argument of pericenter;
+     * (1-e)(1+e) keeps the digits of 1-e^2 for e->1
+     */
+    const TMPL_CT e2  = ecc * ecc;
+    const TMPL_CT E   = TMPL_ATAN2( esinE, ecosE );
+    TMPL_CT       man = E - esinE;
+    TMPL_CT       aph = u - TMPL_ATAN2(
+        TMPL_CM(sqrt)( (TMPL_CL(1.0) - ecc) * (TMPL_CL(1.0) + ecc) ) * esinE,
+        ecosE - e2
+    );
+
+    /* make angles positive */
+    if (inc < TMPL_CL(0.0)) inc += TM_C2PI;
+    if (aph < TMPL_CL(0.0)) aph += TM_C2PI;
+    if (lan < TMPL_CL(0.0)) lan += TM_C2PI;
+    if (man < TMPL_CL(0.0)) man += TM_C2PI;
+
+    ele->sma = (TMPL_ST)(TMPL_CL(1.0) / inva);
+    ele->ecc = ecc_s;
+    ele->inc = (TMPL_ST)inc;
+    ele->aph = (TMPL_ST)aph;
+    ele->lan = (TMPL_ST)lan;
+    ele->man = (TMPL_ST)man;
+
+    /* keep eccentric anomaly for caller ? */
+    if ( ean != nullptr ) *ean = E;
+
+    return 0;
+} // end tm_hco2hel_core
+
+
+/*!
+ * @brief orientation of the orbit, i.e. the first two columns P, Q of the
+ * rotation from the orbital plane to the reference frame
+ * @param[out] p unit vector towards pericenter
+ * @param[out] q unit vector in the orbital plane, 90 deg ahead of \a p
+ * @param[out] dinc derivatives dP/dinc (entries 0-2) and dQ/dinc (entries
+ * 3-5), for the partials (may be nullptr)
+ * @param[in] ele elements, only inc, aph and lan are used
+ * @return none
+ */
+TMPL_LINKAGE void TMPL_FN(tm_orient)(
+    TMPL_CT               p[3],
+    TMPL_CT               q[3],
+    TMPL_CT               dinc[6],
+    const TMPL_HEL* const ele
+    )
+{
+    const TMPL_CT inc    = ele->inc;
+    const TMPL_CT aph    = ele->aph;
+    const TMPL_CT lan    = ele->lan;
+    const TMPL_CT cosinc = TMPL_CM(cos)( inc );
+    const TMPL_CT sininc = TMPL_CM(sin)( inc );
+    const TMPL_CT cosaph = TMPL_CM(cos)( aph );
+    const TMPL_CT sinaph = TMPL_CM(sin)( aph );
+    const TMPL_CT coslan = TMPL_CM(cos)( lan );
+    const TMPL_CT sinlan = TMPL_CM(sin)( lan );
+
+    p[0] =  coslan * cosaph - sinlan * sinaph * cosinc;
+    p[1] =  sinlan * cosaph + coslan * sinaph * cosinc;
+    p[2] =  sinaph * sininc;
+    q[0] = -coslan * sinaph - sinlan * cosaph * cosinc;
+    q[1] = -sinlan * sinaph + coslan * cosaph * cosinc;
+    q[2] =  cosaph * sininc;
+
+    if ( dinc != nullptr )
+    {
+        dinc[0] =  sinlan * sinaph * sininc;
+        dinc[1] = -coslan * sinaph * sininc;
+        dinc[2] =  sinaph * cosinc;
+        dinc[3] =  sinlan * cosaph * sininc;
+        dinc[4] = -coslan * cosaph * sininc;
+        dinc[5] =  cosaph * cosinc;
+    } // end if
+} // end tm_orient
+
+
+/*!
+ * @brief check elements for the conversion to heliocentric coordinates
+ * @param[in] ele source elements
+ * @return true if a > 0 and 0 <= e < 1, false otherwise (also for NaN)
+ */
+TMPL_LINKAGE bool TMPL_FN(tm_hel2hco_valid)(
+    const TMPL_HEL* const ele
+    )
+{
+    return(
+        (ele->sma > TMPL_CL(0.0))
+        && (ele->ecc >= TMPL_CL(0.0)) && (ele->ecc < TMPL_CL(1.0))
+    );
+} // end tm_hel2hco_valid
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates for a
+ * single object with given orientation and eccentric anomaly
+ * @details for callers that solve Kepler's Equation themselves, e.g. with a
+ * warm start; the elements must pass tm_hel2hco_valid(), ele->man is not
+ * used
+ * @param[out] coo resulting coordinates
+ * @param[in] ele source elements
+ * @param[in] p orientation, see tm_orient()
+ * @param[in] q orientation, see tm_orient()
+ * @param[in] mu mass parameter mu = G (m0 + m)
+ * @param[in] with_vel whether to compute velocities, if false only coo->pos
+ * is written
+ * @param[in] sinE sine of eccentric anomaly
+ * @param[in] cosE cosine of eccentric anomaly
+ * @return none
+ */
+TMPL_LINKAGE void TMPL_FN(tm_hel2hco_anom)(
+    TMPL_HCO*             coo,
+    const TMPL_HEL* const ele,
+    const TMPL_CT         p[3],
+    const TMPL_CT         q[3],
+    const TMPL_CT         mu,
+    const bool            with_vel,
+    const TMPL_CT         sinE,
+    const TMPL_CT         cosE
+    )
+{
+    const TMPL_CT sma = ele->sma;
+    const TMPL_CT ecc = ele->ecc;
+
+    /* Cartesian coordinates; (1-e)(1+e) keeps the digits of 1-e^2 for e->1 */
+    const TMPL_CT tmpe = TMPL_CM(sqrt)( (TMPL_CL(1.0) - ecc) * (TMPL_CL(1.0) + ecc) );
+    TMPL_CT       q1   = sma * (cosE - ecc);
+    TMPL_CT       q2   = sma * tmpe * sinE;
+    coo->pos.x = (TMPL_ST)(p[0] * q1 + q[0] * q2);
+    coo->pos.y = (TMPL_ST)(p[1] * q1 + q[1] * q2);
+    coo->pos.z = (TMPL_ST)(p[2] * q1 + q[2] * q2);
+
+    /* positions only ? */
+    if ( !with_vel ) return;
+
+    /* Cartesian velocities */
+    q1  = TMPL_CM(sqrt)( mu ) / ((TMPL_CL(1.0) - ecc * cosE) * TMPL_CM(sqrt)( sma ));
+    q2  = q1 * tmpe * cosE;
+    q1 *= -sinE;
+    coo->vel.x = (TMPL_ST)(p[0] * q1 + q[0] * q2);
+    coo->vel.y = (TMPL_ST)(p[1] * q1 + q[1] * q2);
+    coo->vel.z = (TMPL_ST)(p[2] * q1 + q[2] * q2);
+} // end tm_hel2hco_anom
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates for a
+ * single object with given orientation, e.g. from a cache
+ * @details the Cartesian components are computed in TMPL_CT, Kepler's
+ * Equation is solved in TMPL_KT
+ * @param[out] coo resulting coordinates, only written on success
+ * @param[in] ele source elements
+ * @param[in] p orientation, see tm_orient()
+ * @param[in] q orientation, see tm_orient()
+ * @param[in] mu mass parameter mu = G (m0 + m)
+ * @param[in] with_vel whether to compute velocities, if false only coo->pos
+ * is written
+ * @return 0 = success, 1 = error (a <= 0 or e outside [0, 1))
+ */
+TMPL_LINKAGE int TMPL_FN(tm_hel2hco_rot)(
+    TMPL_HCO*             coo,
+    const TMPL_HEL* const ele,
+    const TMPL_CT         p[3],
+    const TMPL_CT         q[3],
+    const TMPL_CT         mu,
+    const bool            with_vel
+    )
+{
+    /* check a > 0 and 0 <= ecc < 1; NaN fails */
+    if ( !TMPL_FN(tm_hel2hco_valid)( ele ) ) return 1;
+
+    /* eccentric anomaly via solution of Kepler's Equation */
+    TMPL_KT ksinE, kcosE;
+    const TMPL_KT ea = TMPL_KSOLVE( (TMPL_KT)ele->ecc, (TMPL_KT)ele->man );
+    TMPL_FN(tm_sincos)( &ksinE, &kcosE, ea, TMPL_KL(-1.0) );
+
+    TMPL_FN(tm_hel2hco_anom)(
+        coo, ele, p, q, mu, with_vel, (TMPL_CT)ksinE, (TMPL_CT)kcosE
+    );
+
+    return 0;
+} // end tm_hel2hco_rot
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates for a
+ * single object, see hel2hco_ctx()
+ * @param[out] coo resulting coordinates, only written on success
+ * @param[in] ele source elements
+ * @param[in] mu mass parameter mu = G (m0 + m)
+ * @param[in] with_vel whether to compute velocities, if false only coo->pos
+ * is written
+ * @return 0 = success, 1 = error (a <= 0 or e outside [0, 1))
+ */
+TMPL_LINKAGE int TMPL_FN(tm_hel2hco_core)(
+    TMPL_HCO*             coo,
+    const TMPL_HEL* const ele,
+    const TMPL_CT         mu,
+    const bool            with_vel
+    )
+{
+    TMPL_CT p[3], q[3];
+
+    TMPL_FN(tm_orient)( p, q, nullptr, ele );
+
+    return( TMPL_FN(tm_hel2hco_rot)( coo, ele, p, q, mu, with_vel ) );
+} // end tm_hel2hco_core
+
+/******************************************************************************/
+
+/*** remove template parameters ***/
+
+#undef TM_KPI
+#undef TM_K2PI
+#undef TM_C2PI
+
+#undef TMPL_FN
+#undef TMPL_ST
+#undef TMPL_HCO
+#undef TMPL_HEL
+#undef TMPL_CT
+#undef TMPL_CM
+#undef TMPL_CL
+#undef TMPL_KT
+#undef TMPL_KM
+#undef TMPL_KL
+#undef TMPL_KITER
+#undef TMPL_LINKAGE
+#undef TMPL_ATAN2
+#undef TMPL_HYPOT
+#undef TMPL_CBRT
+#undef TMPL_KSOLVE
+
+/******************************************************************************/
@@ -0,0 +1,70 @@
+/***************************************************************************//**
+ * @file    cvt_tmpl_d.h
+ * @brief   double-precision instance of cvt_tmpl.h: tm_*_d()
+ * @details internal header, not part of the public API;
+ *          shared by kepler.c, hco2hel.c and hel2hco.c, so that the double
+ *          kernels are generated from the same template as the other
+ *          precisions; elementary functions from fastmath.h, Kepler's
+ *          Equation in the conversions solved by coo_kesolver()
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_CVT_TMPL_D__H
+#define COO_CVT_TMPL_D__H
+
+/******************************************************************************/
+
+/*** include prerequisite headers ***/
+
+/* include standard headers */
+#include <math.h>
+#include <stdbool.h>
+
+/* include module headers */
+#include "types.h"
+#include "fastmath.h"
+#include "kepler.h"
+
+/******************************************************************************/
+
+/*** template instance ***/
+
+#define TMPL_FN(fn)  fn##_d
+#define TMPL_ST      double
+#define TMPL_HCO     hco_t
+#define TMPL_HEL     hel_t
+#define TMPL_CT      double
+#define TMPL_CM(fn)  fn
+#define TMPL_CL(x)   x
+#define TMPL_KT      double
+#define TMPL_KM(fn)  fn
+#define TMPL_KL(x)   x
+#define TMPL_KITER   0
+#define TMPL_ATAN2   coo_atan2
+#define TMPL_HYPOT   coo_hypot
+#define TMPL_CBRT    coo_cbrt
+#define TMPL_KSOLVE  coo_kesolver
+#include "cvt_tmpl.h"
+
+/******************************************************************************/
+
+#endif  /* COO_CVT_TMPL_D__H */
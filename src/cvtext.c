@@ -0,0 +1,297 @@
+/*******************************************************************************
+ * @file    cvtext.c
+ * @brief   extended-precision conversions between heliocentric coordinates
+ *          and elements for re-running ill-conditioned objects
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+#include <stdbool.h>
+#ifdef COO_FLOAT128
+    #include <quadmath.h>
+#endif
+
+/* include module headers */
+#include "cvtext.h"
+#include "context.h"
+
+/******************************************************************************/
+
+/*** template instance ***/
+
+/* storage in double precision as in body_t, conversion and Kepler solver in
+ * extended precision: tm_*_x(); define COO_FLOAT128 for IEEE quadruple
+ * precision (GCC, link with -lquadmath), default is long double
+ */
+#ifdef COO_FLOAT128
+    typedef __float128 xreal_t;
+    #define TMPL_CM(fn)  fn##q
+    #define TMPL_CL(x)   x##Q
+    #define TMPL_KM(fn)  fn##q
+    #define TMPL_KL(x)   x##Q
+#else
+    typedef long double xreal_t;
+    #define TMPL_CM(fn)  fn##l
+    #define TMPL_CL(x)   x##L
+    #define TMPL_KM(fn)  fn##l
+    #define TMPL_KL(x)   x##L
+#endif
+#define TMPL_FN(fn)  fn##_x
+#define TMPL_ST      double
+#define TMPL_HCO     hco_t
+#define TMPL_HEL     hel_t
+#define TMPL_CT      xreal_t
+#define TMPL_KT      xreal_t
+#define TMPL_KITER   1
+#include "cvt_tmpl.h"
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_refine
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements in extended precision for
+ *                selected objects
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hco for input, obj[].hel for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries; on input bit set for objects to convert, on
+ *                  output bit set for objects that failed again (may be
+ *                  nullptr to convert all objects)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : same partition as hco2hel_ctx(); unselected objects are
+ *                neither read nor written
+ ******************************************************************************/
+int hco2hel_refine(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
+{
+    /* check input */
+    if ( (obj == nullptr) || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const xreal_t gm = (xreal_t)coo_ctx_gm( ctx );
+
+    /* convert selected objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, true, mask, nerr, i,
+        tm_hco2hel_core_x(
+            &obj[i].hel, &obj[i].hco,
+            gm * ((xreal_t)obj[center].mass + obj[i].mass), nullptr
+        )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hco2hel_refine
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_refine_block
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates in extended precision for selected
+ *                objects
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries; on input bit set for objects to convert, on
+ *                  output bit set for objects that failed again (may be
+ *                  nullptr to convert all objects)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *                - Boolean "with_vel" whether to compute velocities
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+static inline int hel2hco_refine_block(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail,
+    const bool       with_vel
+    )
+{
+    /* check input */
+    if ( (obj == nullptr) || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const xreal_t gm = (xreal_t)coo_ctx_gm( ctx );
+
+    /* convert selected objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, true, mask, nerr, i,
+        tm_hel2hco_core_x(
+            &obj[i].hco, &obj[i].hel,
+            gm * ((xreal_t)obj[center].mass + obj[i].mass), with_vel
+        )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hel2hco_refine_block
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_refine
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates in extended precision for selected
+ *                objects
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap, see hco2hel_refine()
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_refine(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
+{
+    return( hel2hco_refine_block( ctx, obj, dim, center, mask, nfail, true ) );
+} // end hel2hco_refine
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_pos_refine
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian positions only in extended precision for selected
+ *                objects
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco.pos for
+ *                  output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap, see hco2hel_refine()
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_pos_refine(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
+{
+    return( hel2hco_refine_block( ctx, obj, dim, center, mask, nfail, false ) );
+} // end hel2hco_pos_refine
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_mask_ecc
+ *  DESCRIPTION : flag objects with eccentricity close to or above 1,
+ *                for which the conversions in double precision lose digits
+ *  INPUT       : - pointer "obj" to array of type body_t
+ *                  (using members obj[].hel.ecc)
+ *                - dimension "dim" of array
+ *                - index "center" for central body (never flagged)
+ *                - threshold "emin" for eccentricity
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bits are set for objects with ecc >= emin
+ *                  or NaN, other bits are left unchanged
+ *                - pointer "nflag" for number of newly flagged objects
+ *                  (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int coo_mask_ecc(
+    const body_t   obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    const double   emin,
+    uint64_t       mask[],
+    uint32_t*      nflag
+    )
+{
+    /* check input */
+    if ( (obj == nullptr) || (mask == nullptr) || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    uint32_t nnew = 0;
+
+    for (register uint32_t w = 0; w < COO_MASK_WORDS(dim); w++)
+    {
+        const uint32_t lo   = w * 64u;
+        const uint32_t hi   = (dim - lo < 64u) ? dim : lo + 64u;
+        uint64_t       bits = 0;
+
+        for (register uint32_t i = lo; i < hi; i++)
+        {
+            if ( i == center ) continue;
+            bits |= (uint64_t)!(obj[i].hel.ecc < emin) << (i - lo);
+        } // end for
+
+        /* count only objects not flagged before */
+        for (uint64_t b = bits & ~mask[w]; b != 0; b &= b - 1) nnew++;
+        mask[w] |= bits;
+    } // end for
+
+    if ( nflag != nullptr ) *nflag = nnew;
+
+    return 0;
+} // end coo_mask_ecc
+
+/******************************************************************************/
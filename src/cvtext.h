@@ -0,0 +1,150 @@
+/***************************************************************************//**
+ * @file    cvtext.h
+ * @brief   extended-precision conversions between heliocentric coordinates
+ *          and elements for re-running ill-conditioned objects
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_CVTEXT__H
+#define COO_CVTEXT__H
+
+/******************************************************************************/
+
+/*** include prerequisite headers ***/
+
+/* include module headers */
+#include "types.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements in
+ * extended precision for selected objects
+ * @details input and output stay in double precision (#body_t), all
+ * intermediate results are computed in long double, or in __float128 if
+ * the library is built with COO_FLOAT128; intended for re-running
+ * objects flagged by a fast double-precision batch
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[in,out] mask status bitmap with COO_MASK_WORDS(dim) entries; on
+ * input bit set for each object to convert, on output bit set for each
+ * object that failed again (may be nullptr to convert all objects)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_refine(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates in
+ * extended precision for selected objects
+ * @details see hco2hel_refine()
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[in,out] mask status bitmap with COO_MASK_WORDS(dim) entries; on
+ * input bit set for each object to convert, on output bit set for each
+ * object that failed again (may be nullptr to convert all objects)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_refine(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric positions only in
+ * extended precision for selected objects
+ * @details see hco2hel_refine(); members obj[].hco.vel are not written
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[in,out] mask status bitmap with COO_MASK_WORDS(dim) entries; on
+ * input bit set for each object to convert, on output bit set for each
+ * object that failed again (may be nullptr to convert all objects)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_pos_refine(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+
+/*!
+ * @brief flag objects with eccentricity close to or above 1
+ * @details sets the bits of all objects with obj[].hel.ecc >= \a emin or
+ * NaN and leaves the other bits unchanged, so that it can be applied to the
+ * mask of a conversion, e.g. after hco2hel on the resulting elements or
+ * before hel2hco on the input elements; the flagged objects are then
+ * re-run with coocvt_refine()
+ * @param[in] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (never flagged)
+ * @param[in] emin threshold for eccentricity, e.g. 0.99
+ * @param[in,out] mask status bitmap with COO_MASK_WORDS(dim) entries
+ * @param[out] nflag number of newly flagged objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int coo_mask_ecc(
+    const body_t   obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    const double   emin,
+    uint64_t       mask[],
+    uint32_t*      nflag
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* COO_CVTEXT__H */
@@ -0,0 +1,340 @@
+/*******************************************************************************
+ * @file    cvtfloat.c
+ * @brief   single- and mixed-precision conversions between heliocentric
+ *          coordinates and elements for compact arrays
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+#include <stdbool.h>
+
+/* include module headers */
+#include "cvtfloat.h"
+#include "context.h"
+#include "fastmath.h"
+#include "kepler.h"
+
+/******************************************************************************/
+
+/*** template instances ***/
+
+/* single precision throughout: tm_*_f() */
+#define TMPL_FN(fn)  fn##_f
+#define TMPL_ST      float
+#define TMPL_HCO     hcof_t
+#define TMPL_HEL     helf_t
+#define TMPL_CT      float
+#define TMPL_CM(fn)  fn##f
+#define TMPL_CL(x)   x##f
+#define TMPL_KT      float
+#define TMPL_KM(fn)  fn##f
+#define TMPL_KL(x)   x##f
+#define TMPL_KITER   0
+#define TMPL_ATAN2   coo_atan2f
+#include "cvt_tmpl.h"
+
+/* single-precision storage and conversion, Kepler's Equation solved in
+ * double precision by coo_kesolver(): tm_*_mf()
+ */
+#define TMPL_FN(fn)  fn##_mf
+#define TMPL_ST      float
+#define TMPL_HCO     hcof_t
+#define TMPL_HEL     helf_t
+#define TMPL_CT      float
+#define TMPL_CM(fn)  fn##f
+#define TMPL_CL(x)   x##f
+#define TMPL_KT      double
+#define TMPL_KM(fn)  fn
+#define TMPL_KL(x)   x
+#define TMPL_KITER   0
+#define TMPL_ATAN2   coo_atan2f
+#define TMPL_KSOLVE  coo_kesolver
+#include "cvt_tmpl.h"
+
+/******************************************************************************/
+
+/*** internal constants ***/
+
+/* zero coordinates and elements for central body */
+static const hcof_t hcof_zero = { { 0.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 0.0f } };
+static const helf_t helf_zero = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_kesolver_f
+ *  DESCRIPTION : solver for Kepler Equation in single precision
+ *  INPUT       : - value "ecc" for eccentricity 0 <= ecc < 1
+ *                - value "ma" for mean anomaly in radians,
+ *                  any arbitrary real number is OK
+ *  OUTPUT      : solution E(e,M) for eccentric anomaly in range 0 <= E < 2*pi
+ ******************************************************************************/
+COO_DISPATCH float coo_kesolver_f(
+    const float ecc,
+    const float ma
+    )
+{
+    return( tm_kesolver_f( ecc, ma ) );
+} // end coo_kesolver_f
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_arr_f
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements in single precision for all
+ *                objects of compact arrays, and report objects with
+ *                invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - array "ele" of type helf_t for output elements
+ *                - array "coo" of type hcof_t for input coordinates
+ *                - array "mass" of masses
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : same partition as hco2hel_arr()
+ ******************************************************************************/
+COO_DISPATCH int hco2hel_arr_f(
+    const coo_ctx_t*           ctx,
+    helf_t* COO_RESTRICT       ele,
+    const hcof_t* COO_RESTRICT coo,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    /* check input */
+    if ( (ele == nullptr) || (coo == nullptr) || (mass == nullptr)
+         || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* set central object to zero */
+    ele[center] = helf_zero;
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const float gm = (float)coo_ctx_gm( ctx );
+
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        tm_hco2hel_core_f(
+            &ele[i], &coo[i], gm * (mass[center] + mass[i]), nullptr
+        )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hco2hel_arr_f
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_arr_f_block
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates in single precision for all objects
+ *                of compact arrays, and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - array "coo" of type hcof_t for output coordinates
+ *                - array "ele" of type helf_t for input elements
+ *                - array "mass" of masses
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *                - Boolean "with_vel" whether to compute velocities
+ *                - Boolean "mixed" whether to solve Kepler's Equation in
+ *                  double precision
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : same partition as hel2hco_arr_block()
+ ******************************************************************************/
+COO_DISPATCH static int hel2hco_arr_f_block(
+    const coo_ctx_t*           ctx,
+    hcof_t* COO_RESTRICT       coo,
+    const helf_t* COO_RESTRICT ele,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail,
+    const bool                 with_vel,
+    const bool                 mixed
+    )
+{
+    /* check input */
+    if ( (coo == nullptr) || (ele == nullptr) || (mass == nullptr)
+         || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* set central object to zero */
+    if ( with_vel ) coo[center]     = hcof_zero;
+    else            coo[center].pos = hcof_zero.pos;
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const float gm = (float)coo_ctx_gm( ctx );
+
+    /* convert other objects, block-wise; Kepler's Equation in double
+     * precision if mixed
+     */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        mixed
+        ? tm_hel2hco_core_mf(
+            &coo[i], &ele[i], gm * (mass[center] + mass[i]), with_vel
+        )
+        : tm_hel2hco_core_f(
+            &coo[i], &ele[i], gm * (mass[center] + mass[i]), with_vel
+        )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hel2hco_arr_f_block
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_arr_f
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates in single precision for all objects
+ *                of compact arrays, and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - array "coo" of type hcof_t for output coordinates
+ *                - array "ele" of type helf_t for input elements
+ *                - array "mass" of masses
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_arr_f(
+    const coo_ctx_t*           ctx,
+    hcof_t* COO_RESTRICT       coo,
+    const helf_t* COO_RESTRICT ele,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    return( hel2hco_arr_f_block(
+        ctx, coo, ele, mass, dim, center, mask, nfail, true, false
+    ) );
+} // end hel2hco_arr_f
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_pos_arr_f
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian positions only in single precision for all
+ *                objects of compact arrays, and report objects with
+ *                invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - array "coo" of type hcof_t for output positions
+ *                  (members coo[].vel are not written)
+ *                - array "ele" of type helf_t for input elements
+ *                - array "mass" of masses
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_pos_arr_f(
+    const coo_ctx_t*           ctx,
+    hcof_t* COO_RESTRICT       coo,
+    const helf_t* COO_RESTRICT ele,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    return( hel2hco_arr_f_block(
+        ctx, coo, ele, mass, dim, center, mask, nfail, false, false
+    ) );
+} // end hel2hco_pos_arr_f
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_arr_mf
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates in mixed precision for all objects
+ *                of compact arrays, and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - array "coo" of type hcof_t for output coordinates
+ *                - array "ele" of type helf_t for input elements
+ *                - array "mass" of masses
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : storage and orientation in single precision, Kepler's
+ *                Equation solved in double precision, which keeps the
+ *                eccentric anomaly accurate for e -> 1
+ ******************************************************************************/
+int hel2hco_arr_mf(
+    const coo_ctx_t*           ctx,
+    hcof_t* COO_RESTRICT       coo,
+    const helf_t* COO_RESTRICT ele,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    return( hel2hco_arr_f_block(
+        ctx, coo, ele, mass, dim, center, mask, nfail, true, true
+    ) );
+} // end hel2hco_arr_mf
+
+/******************************************************************************/
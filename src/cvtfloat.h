@@ -0,0 +1,176 @@
+/***************************************************************************//**
+ * @file    cvtfloat.h
+ * @brief   single- and mixed-precision conversions between heliocentric
+ *          coordinates and elements for compact arrays
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_CVTFLOAT__H
+#define COO_CVTFLOAT__H
+
+/******************************************************************************/
+
+/*** include prerequisite headers ***/
+
+/* include module headers */
+#include "types.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief solver for Kepler Equation in single precision
+ * @details same method as coo_kesolver()
+ * @param[in] ecc eccentricity, 0 <= ecc < 1
+ * @param[in] ma mean anomaly in radians
+ * @return eccentric anomaly in radians, 0 <= E < 2 pi
+ */
+float coo_kesolver_f(
+    const float ecc,
+    const float ma
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements
+ * in single precision for compact arrays
+ * @details same as hco2hel_arr() for arrays of #hcof_t, #helf_t and
+ * float masses; all arithmetic in single precision
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] ele array of type #helf_t for elements
+ * @param[in] coo array of type #hcof_t for coordinates
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_arr_f(
+    const coo_ctx_t*           ctx,
+    helf_t* COO_RESTRICT       ele,
+    const hcof_t* COO_RESTRICT coo,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * in single precision for compact arrays
+ * @details same as hel2hco_arr() for arrays of #hcof_t, #helf_t and
+ * float masses; all arithmetic in single precision
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] coo array of type #hcof_t for coordinates
+ * @param[in] ele array of type #helf_t for elements
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_arr_f(
+    const coo_ctx_t*           ctx,
+    hcof_t* COO_RESTRICT       coo,
+    const helf_t* COO_RESTRICT ele,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric positions only
+ * in single precision for compact arrays
+ * @details same as hel2hco_arr_f(), but members coo[].vel are not written
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] coo array of type #hcof_t for positions (coo[].vel unused)
+ * @param[in] ele array of type #helf_t for elements
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_pos_arr_f(
+    const coo_ctx_t*           ctx,
+    hcof_t* COO_RESTRICT       coo,
+    const helf_t* COO_RESTRICT ele,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * in mixed precision for compact arrays
+ * @details like hel2hco_arr_f(), with single-precision storage and
+ * orientation, but Kepler's Equation is solved in double precision;
+ * the eccentric anomaly stays accurate for highly eccentric orbits, where
+ * the single-precision solver loses most of its digits
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] coo array of type #hcof_t for coordinates
+ * @param[in] ele array of type #helf_t for elements
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_arr_mf(
+    const coo_ctx_t*           ctx,
+    hcof_t* COO_RESTRICT       coo,
+    const helf_t* COO_RESTRICT ele,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* COO_CVTFLOAT__H */
@@ -12,7 +12,9 @@
  ******************************************************************************/
 /* include module headers */
 #include "hco2bco.h"
+#include "barycenter.h"
 #include "utils.h"
+#include "context.h"
 
 /******************************************************************************/
 
@@ -24,6 +26,163 @@
 
 /******************************************************************************/
 
+/*******************************************************************************
+ *  FUNCTION    : hco2bco_block
+ *  DESCRIPTION : convert from heliocentric Cartesian coordinates to
+ *                barycentric Cartesian coordinates
+ *                using the settings of a conversion context
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" to array of type body_t for output
+ *                  (using members dst[].bco)
+ *                - pointer "src" to array of type body_t for input
+ *                  (using members src[].hco and src[].mass), may be equal
+ *                  to "dst" for in-place conversion (hence not restrict)
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+COO_DISPATCH static int hco2bco_block(
+    const coo_ctx_t* ctx,
+    body_t*          dst,
+    const body_t*    src,
+    const uint32_t   dim,
+    const uint32_t   center
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) || (dim <= center) )
+    {
+        /* TODO FIXME print error message */
+        return 1;
+    } // end if
+
+    /* determine barycenter (center of mass) position/velocity */
+    hco_t bc; /* barycenter */
+    if ( coo_get_barycenter_ctx( ctx, &bc, src, 0, dim, COO_HCO ) != 0 )
+    {
+        /* TODO FIXME print error message */
+        return 1;
+    } // end if
+
+    /***
+     * subtract barycenter position/velocity "bc" from all objects
+     * to transform to barycentric coordinates:
+     * bco = hco - bc
+     * (translations never fail, no central object is skipped)
+     ***/
+    uint64_t* const nomask = nullptr;
+    uint32_t        nerr   = 0;
+    COO_BLOCK_LOOP(
+        ctx, dim, dim, false, nomask, nerr, i,
+        (coo_recenter( &dst[i].bco, &src[i].hco, &bc ), 0)
+    );
+
+    return 0;
+} // end hco2bco_block
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2bco_block_oop
+ *  DESCRIPTION : convert from heliocentric Cartesian coordinates to
+ *                barycentric Cartesian coordinates, out of place
+ *  INPUT       : see hco2bco_block(), but "dst" and "src" must not overlap
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : same loop as hco2bco_block(), instantiated with restrict
+ *                pointers
+ ******************************************************************************/
+COO_DISPATCH static int hco2bco_block_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) || (dim <= center) )
+    {
+        /* TODO FIXME print error message */
+        return 1;
+    } // end if
+
+    /* determine barycenter (center of mass) position/velocity */
+    hco_t bc; /* barycenter */
+    if ( coo_get_barycenter_ctx( ctx, &bc, src, 0, dim, COO_HCO ) != 0 )
+    {
+        /* TODO FIXME print error message */
+        return 1;
+    } // end if
+
+    /***
+     * subtract barycenter position/velocity "bc" from all objects
+     * to transform to barycentric coordinates:
+     * bco = hco - bc
+     * (translations never fail, no central object is skipped)
+     ***/
+    uint64_t* const nomask = nullptr;
+    uint32_t        nerr   = 0;
+    COO_BLOCK_LOOP(
+        ctx, dim, dim, false, nomask, nerr, i,
+        (coo_recenter( &dst[i].bco, &src[i].hco, &bc ), 0)
+    );
+
+    return 0;
+} // end hco2bco_block_oop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2bco_ctx
+ *  DESCRIPTION : convert from heliocentric Cartesian coordinates to
+ *                barycentric Cartesian coordinates
+ *                using the settings of a conversion context
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hco for input, obj[].bco for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hco2bco_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center
+    )
+{
+    return( hco2bco_block( ctx, obj, obj, dim, center ) );
+} // end hco2bco_ctx
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2bco_oop
+ *  DESCRIPTION : convert from heliocentric Cartesian coordinates to
+ *                barycentric Cartesian coordinates, out of place
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" to array of type body_t for output
+ *                  (using members dst[].bco, other members are not touched)
+ *                - pointer "src" to array of type body_t for input
+ *                  (using members src[].hco and src[].mass), must not
+ *                  overlap with "dst"
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hco2bco_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center
+    )
+{
+    return( hco2bco_block_oop( ctx, dst, src, dim, center ) );
+} // end hco2bco_oop
+
+/******************************************************************************/
+
 /*******************************************************************************
  *  FUNCTION    : hco2bco
  *  DESCRIPTION : convert from heliocentric Cartesian coordinates to
@@ -39,33 +198,52 @@ int hco2bco(
     const uint32_t dim,
     const uint32_t center
     )
+{
+    return( hco2bco_ctx( nullptr, obj, dim, center ) );
+} // end hco2bco
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2bco_acc
+ *  DESCRIPTION : convert from heliocentric Cartesian coordinates to
+ *                barycentric Cartesian coordinates, using a barycenter
+ *                accumulator that is maintained by the caller
+ *  INPUT       : - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hco for input, obj[].bco for output)
+ *                - dimension "dim" of array
+ *                - pointer "acc" to barycenter accumulator of type bcacc_t
+ *                  holding the heliocentric coordinates of all objects
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hco2bco_acc(
+    body_t               obj[],
+    const uint32_t       dim,
+    const bcacc_t* const acc
+    )
 {
     /* check input */
-    if ( (obj == nullptr) || (dim < center) )
+    if ( obj == nullptr )
     {
         /* TODO FIXME print error message */
         return 1;
     } // end if
 
-    /* determine barycenter (center of mass) position/velocity */
+    /* barycenter position/velocity from running sums */
     hco_t bc; /* barycenter */
-    if ( coo_get_barycenter( &bc, obj, 0, dim, COO_HCO ) != 0 )
+    if ( coo_bcacc_get( &bc, acc ) != 0 )
     {
         /* TODO FIXME print error message */
         return 1;
     } // end if
 
-    /***
-     * subtract barycenter position/velocity "bc" from all objects
-     * to transform to barycentric coordinates:
-     * bco = hco - bc
-     ***/
+    /* bco = hco - bc */
     for (register uint32_t i = 0; i < dim; i++)
     {
         coo_recenter( &obj[i].bco, &obj[i].hco, &bc );
     } // end for
 
     return 0;
-} // end hco2bco
+} // end hco2bco_acc
 
 /******************************************************************************/
@@ -35,6 +35,62 @@ int hco2bco(
     const uint32_t center
 );
 
+
+/*!
+ * @brief convert heliocentric coordinates to barycentric coordinates
+ * using the settings of a conversion context
+ * @details identical to hco2bco(), but with the number of threads taken
+ * from \a ctx
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @return 0 for success, 1 for error
+ */
+int hco2bco_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to barycentric coordinates,
+ * out of place
+ * @details reads src[].hco and src[].mass, writes dst[].bco only
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] dst array of type #body_t for output
+ * @param[in] src array of type #body_t for input, must not overlap \a dst
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body
+ * @return 0 for success, 1 for error
+ */
+int hco2bco_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to barycentric coordinates
+ * using a barycenter accumulator
+ * @details the accumulator must hold the heliocentric coordinates of all
+ * objects, see coo_bcacc_fill(); only the recentering pass is performed
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] acc barycenter accumulator of type #bcacc_t
+ * @return 0 for success, 1 for error
+ */
+int hco2bco_acc(
+    body_t               obj[],
+    const uint32_t       dim,
+    const bcacc_t* const acc
+);
+
 #ifdef __cplusplus
 }
 #endif
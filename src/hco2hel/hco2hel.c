@@ -17,6 +17,9 @@
 /* include module headers */
 #include "hco2hel.h"
 #include "const.h"
+#include "context.h"
+#include "view.h"
+#include "cvt_tmpl_d.h"
 #include "utils.h"
 #include "vec3d.h"
 
@@ -28,113 +31,624 @@
     #include <stdio.h>
 #endif
 
+/* smallest eccentricity and sin(inc) for partials, sqrt(DBL_EPSILON):
+ * aph and lan are ill-defined for circular and planar orbits, and the
+ * partials grow like 1/e and 1/sin(inc)
+ */
+#define HCO2HEL_JAC_TOL 1.4901161193847656e-08
+
+/******************************************************************************/
+
 /******************************************************************************/
 
 /*******************************************************************************
- *  FUNCTION    : hco2hel_core
- *  DESCRIPTION : convert from heliocentric cartesian coordinates to
- *                heliocentric orbital elements for single object
- *  INPUT       : - pointer "ele" of type hel_t for resulting elements
+ *  FUNCTION    : hco2hel_core_jac
+ *  DESCRIPTION : evaluate the matrix of partial derivatives
+ *                d(elements) / d(pos,vel) for single object
+ *  INPUT       : - pointer "jac" of type jac_t for resulting partials
  *                - pointer "coo" of type hco_t for source coordinates
+ *                - pointer "ele" of type hel_t for elements of "coo", as
+ *                  found by tm_hco2hel_core_d()
  *                - value for mass parameter mu = m0 + m(i)
- *  OUTPUT      : 0 = success, 1 = error
- *  REFERENCES  : TODO
+ *  OUTPUT      : none
+ *  NOTE        : column k holds the directional derivatives of the
+ *                quantities of tm_hco2hel_core_d() along state component k,
+ *                i.e. of 1/a = 2/r - v^2/mu, e^2 = 1 - p/a with p = h^2/mu,
+ *                inc and lan from h = r x v, man = E - e sinE with
+ *                e cosE = 1 - r/a and e sinE = (r.v) / (mu a)^1/2, and
+ *                aph = u - nu with the argument of latitude u and the true
+ *                anomaly nu (e cos(nu) = p/r - 1, e sin(nu) = h (r.v) / (mu r));
+ *                the caller has to ensure e > 0 and sin(inc) > 0
  ******************************************************************************/
-static int hco2hel_core(
-    hel_t*             ele,
+static void hco2hel_core_jac(
+    jac_t*             jac,
     const hco_t* const coo,
+    const hel_t* const ele,
     const double       mu
     )
 {
-    vec3d_t angm, nvel;
+    const double R[3] = { coo->pos.x, coo->pos.y, coo->pos.z };
+    const double V[3] = { coo->vel.x, coo->vel.y, coo->vel.z };
+
+    /* quantities of the conversion */
+    const double a   = ele->sma;
+    const double e2  = ele->ecc * ele->ecc;
+    const double r   = sqrt( R[0] * R[0] + R[1] * R[1] + R[2] * R[2] );
+    const double rv  = R[0] * V[0] + R[1] * V[1] + R[2] * V[2];
+    const double H[3] = {
+        R[1] * V[2] - R[2] * V[1],
+        R[2] * V[0] - R[0] * V[2],
+        R[0] * V[1] - R[1] * V[0]
+    };
+    const double hxy2 = H[0] * H[0] + H[1] * H[1];
+    const double hxy  = sqrt( hxy2 );
+    const double h2   = hxy2 + H[2] * H[2];
+    const double h    = sqrt( h2 );
+    const double p    = h2 / mu;
+    const double sqma = sqrt( mu * a );
 
-    /* absolute value of position vector */
-    const double pabs = vec3d_abs( &coo->pos );
+    /* e cosE, e sinE; e cos(nu), e sin(nu); argument of latitude */
+    const double C  = 1.0 - r / a;
+    const double S  = rv / sqma;
+    const double Pc = p / r - 1.0;
+    const double Ps = h * rv / (mu * r);
+    const double U1 = R[2] * h;
+    const double U2 = H[0] * R[1] - H[1] * R[0];
+    const double U  = U1 * U1 + U2 * U2;
 
-    /* normalised velocity: nvel = vel / (mu)^1/2 */
-    //const double vtmp = 1.0 / (gaussk * sqrt(mu));
-    //const double vtmp = 1.0 / sqrt( mu );
-    vec3d_smul( &nvel, &coo->vel, 1.0 / sqrt( mu ) );
-    nvel.abs = vec3d_abs( &nvel );
+    for (register int k = 0; k < 6; k++)
+    {
+        /* unit step in state component k */
+        double dR[3] = { 0.0, 0.0, 0.0 };
+        double dV[3] = { 0.0, 0.0, 0.0 };
+        if ( k < 3 ) dR[k]     = 1.0;
+        else         dV[k - 3] = 1.0;
 
-    /* specific angular momentum: angm = r x v */
-    vec3d_outer( &angm, &coo->pos, &nvel );
-    angm.abs = vec3d_abs( &angm );
+        const double dr  = (R[0] * dR[0] + R[1] * dR[1] + R[2] * dR[2]) / r;
+        const double drv = V[0] * dR[0] + V[1] * dR[1] + V[2] * dR[2]
+                         + R[0] * dV[0] + R[1] * dV[1] + R[2] * dV[2];
+        const double dv2 = 2.0 * (V[0] * dV[0] + V[1] * dV[1] + V[2] * dV[2]);
 
-    /* inclination */
-    ele->inc = atan2( hypot(angm.x, angm.y), angm.z );
+        /* dH = dR x V + R x dV */
+        const double dH[3] = {
+            dR[1] * V[2] - dR[2] * V[1] + R[1] * dV[2] - R[2] * dV[1],
+            dR[2] * V[0] - dR[0] * V[2] + R[2] * dV[0] - R[0] * dV[2],
+            dR[0] * V[1] - dR[1] * V[0] + R[0] * dV[1] - R[1] * dV[0]
+        };
+        const double dhxy = (H[0] * dH[0] + H[1] * dH[1]) / hxy;
+        const double dh   = (hxy * dhxy + H[2] * dH[2]) / h;
+        const double dp   = 2.0 * h * dh / mu;
 
-    /* longitude of ascending node */
-    ele->lan = atan2( angm.x, -angm.y );
+        /* semi-major axis and eccentricity */
+        const double da = a * a * (2.0 * dr / (r * r) + dv2 / mu);
+        const double de = (p * da / (a * a) - dp / a) / (2.0 * ele->ecc);
 
-    /* argument of latitude:
-     * u = v + w = true anomaly + argument of pericenter
-     */
-    const double u = atan2(
-        coo->pos.z * angm.abs,
-        coo->pos.y * angm.x - coo->pos.x * angm.y
-    );
+        /* inclination and longitude of node */
+        const double di = (H[2] * dhxy - hxy * dH[2]) / h2;
+        const double dl = (H[0] * dH[1] - H[1] * dH[0]) / hxy2;
+
+        /* mean anomaly M = E - e sinE */
+        const double dC = (r * da / a - dr) / a;
+        const double dS = drv / sqma - 0.5 * S * da / a;
+        const double dE = (C * dS - S * dC) / e2;
+
+        /* argument of pericenter aph = u - nu */
+        const double dPc = (dp - p * dr / r) / r;
+        const double dPs = (dh * rv + h * drv) / (mu * r) - Ps * dr / r;
+        const double dnu = (Pc * dPs - Ps * dPc) / e2;
+        const double dU1 = dR[2] * h + R[2] * dh;
+        const double dU2 = dH[0] * R[1] + H[0] * dR[1]
+                         - dH[1] * R[0] - H[1] * dR[0];
+        const double du  = (U2 * dU1 - U1 * dU2) / U;
+
+        jac->m[0][k] = da;
+        jac->m[1][k] = de;
+        jac->m[2][k] = di;
+        jac->m[3][k] = du - dnu;
+        jac->m[4][k] = dl;
+        jac->m[5][k] = dE - dS;
+    } // end for
+} // end hco2hel_core_jac
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_one
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for single object of an array
+ *  INPUT       : - pointer "dst" to array of type body_t for output
+ *                  (using members dst[].hel)
+ *                - pointer "src" to array of type body_t for input
+ *                  (using members src[].hco and src[].mass), may be equal
+ *                  to "dst"
+ *                - index "center" for central body
+ *                - index "i" of object
+ *                - value "gm" for gravitational constant
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+static inline int hco2hel_one(
+    body_t*        dst,
+    const body_t*  src,
+    const uint32_t center,
+    const uint32_t i,
+    const double   gm
+    )
+{
+    /* mass parameter G(M+m) */
+    const double mu = gm * (src[center].mass + src[i].mass);
+
+    return( tm_hco2hel_core_d( &dst[i].hel, &src[i].hco, mu, nullptr ) );
+} // end hco2hel_one
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_view_one
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for single object of a view
+ *  INPUT       : - pointer "dst" of type view_t for output
+ *                - pointer "src" of type view_t for input, may be equal to
+ *                  "dst"
+ *                - index "i" of object
+ *                - value for mass parameter mu = m0 + m(i)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : the object is gathered into registers, converted, and
+ *                scattered back on success
+ ******************************************************************************/
+static inline int hco2hel_view_one(
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      i,
+    const double        mu
+    )
+{
+    hco_t coo;
+    hel_t ele;
+    coo_view_get_hco( &coo, src, i );
+
+    /* keep previous output of failed conversion */
+    const int err = tm_hco2hel_core_d( &ele, &coo, mu, nullptr );
+    if ( err == 0 ) coo_view_set_hel( dst, i, &ele );
 
-    /* semi-major axis: 1 / a = 2 / |r| - |v|^2 */
-    //ele->sma = 1.0 / ((2.0 / pabs) - nvel.abs * nvel.abs);
-    const double inva = (2.0 / pabs) - nvel.abs * nvel.abs;
-    /* check for correct semi-major axis: a > 0 */
-    if ( inva > 0.0 )
+    return err;
+} // end hco2hel_view_one
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_jac_one
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for single object, together
+ *                with the partial derivatives d(elements) / d(pos,vel)
+ *  INPUT       : - pointer "obj" to array of type body_t for coordinates
+ *                - pointer "jac" to array of type jac_t for partials
+ *                - index "i" of object
+ *                - value for mass parameter mu = m0 + m(i)
+ *  OUTPUT      : 0 = success, 1 = error (no valid partials, jac[i] is set
+ *                to zero)
+ ******************************************************************************/
+static inline int hco2hel_jac_one(
+    body_t         obj[],
+    jac_t          jac[],
+    const uint32_t i,
+    const double   mu
+    )
+{
+    /* no partials for invalid elements, circular or planar orbits */
+    double ea;
+    if ( (tm_hco2hel_core_d( &obj[i].hel, &obj[i].hco, mu, &ea ) != 0)
+      || (obj[i].hel.ecc < HCO2HEL_JAC_TOL)
+      || (fabs( sin( obj[i].hel.inc ) ) < HCO2HEL_JAC_TOL) )
     {
-        ele->sma = 1.0 / inva;
+        jac[i] = jac_zero;
+        return 1;
     } // end if
-    else
+
+    hco2hel_core_jac( &jac[i], &obj[i].hco, &obj[i].hel, mu );
+
+    return 0;
+} // end hco2hel_jac_one
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_block
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for all objects,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr for
+ *                  default settings: G = gaussk2, serial loop)
+ *                - pointer "dst" to array of type body_t for output
+ *                  (using members dst[].hel)
+ *                - pointer "src" to array of type body_t for input
+ *                  (using members src[].hco and src[].mass), may be equal
+ *                  to "dst" for in-place conversion (hence not restrict)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : objects are processed in blocks of 64, matching one word
+ *                of the bitmap, so that each word is written only once;
+ *                blocks are distributed over the threads of the context
+ ******************************************************************************/
+COO_DISPATCH static int hco2hel_block(
+    const coo_ctx_t* ctx,
+    body_t*          dst,
+    const body_t*    src,
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) || (dim <= center) )
     {
-#if HCO2HEL_DEBUG
-    fprintf(
-        stderr,
-        "%s: Error = invalid semi-major axis 1/a = %g\n",
-        __func__, inva
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* set central object to zero */
+    dst[center].hel = hel_zero;
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const double gm = coo_ctx_gm( ctx );
+
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        hco2hel_one( dst, src, center, i, gm )
     );
-#endif
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hco2hel_block
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_block_oop
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for all objects, out of place,
+ *                and report objects with invalid input
+ *  INPUT       : see hco2hel_block(), but "dst" and "src" must not overlap
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : same loop as hco2hel_block(), instantiated with restrict
+ *                pointers, so that src[] need not be reloaded after each
+ *                store to dst[]
+ ******************************************************************************/
+COO_DISPATCH static int hco2hel_block_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) || (dim <= center) )
+    {
+        /* TODO print error message */
         return 1;
-    } // end else
-
-    /* components of eccentric anomaly */
-    //const double ecosE = 1.0 - pabs / ele->sma;
-    const double ecosE = 1.0 - pabs * inva;
-    //const double esinE = vec3d_inner( &coo->pos, &nvel ) / sqrt( ele->sma );
-    const double esinE = vec3d_inner( &coo->pos, &nvel ) * sqrt( inva );
-    const double E     = atan2( esinE, ecosE );
-
-    /* eccentricity */
-    ele->ecc = hypot( esinE, ecosE );
-    /* check for correct eccentricity: 0 <= e < 1 */
-    if ( (ele->ecc < 0.0) || (ele->ecc >= 1.0) )
+    } // end if
+
+    /* set central object to zero */
+    dst[center].hel = hel_zero;
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const double gm = coo_ctx_gm( ctx );
+
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        hco2hel_one( dst, src, center, i, gm )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hco2hel_block_oop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_ctx
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for all objects,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr for
+ *                  default settings: G = gaussk2, serial loop)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hco for input, obj[].hel for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hco2hel_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
+{
+    return( hco2hel_block( ctx, obj, obj, dim, center, mask, nfail ) );
+} // end hco2hel_ctx
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_oop
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for all objects, out of place,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" to array of type body_t for output
+ *                  (using members dst[].hel, other members are not touched)
+ *                - pointer "src" to array of type body_t for input
+ *                  (using members src[].hco and src[].mass), must not
+ *                  overlap with "dst"
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hco2hel_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    return( hco2hel_block_oop( ctx, dst, src, dim, center, mask, nfail ) );
+} // end hco2hel_oop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_range
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for a contiguous range of
+ *                objects, and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hco for input, obj[].hel for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - index "first" of first object, multiple of 64
+ *                - number "count" of objects, multiple of 64 unless the
+ *                  range reaches the end of the array (first+count >= dim)
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, only the words of the range are written
+ *                  (may be nullptr)
+ *                - pointer "nfail" for number of failed objects in the range
+ *                  (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : serial loop over the blocks of hco2hel_block(), see
+ *                hel2hco_range()
+ ******************************************************************************/
+COO_DISPATCH int hco2hel_range(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    const uint32_t   first,
+    const uint32_t   count,
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
+{
+    /* check input */
+    if ( (obj == nullptr) || (dim <= center) || (first % 64u != 0) )
     {
-#if HCO2HEL_DEBUG
-    fprintf(
-        stderr,
-        "%s: Error = invalid eccentricity e = %g\n",
-        __func__, ele->ecc
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* a range ending inside a block would share its word with the next */
+    if ( (count % 64u != 0) && (first < dim) && (count < dim - first) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* range of blocks */
+    const uint32_t last = (first >= dim)         ? first
+                        : (count < dim - first) ? first + count : dim;
+    const uint32_t w0   = first / 64u;
+    const uint32_t w1   = COO_MASK_WORDS(last);
+
+    /* set central object to zero, if part of the range */
+    if ( (center >= first) && (center < last) ) obj[center].hel = hel_zero;
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* convert objects, block-wise */
+    const double gm = coo_ctx_gm( ctx );
+    for (register uint32_t w = w0; w < w1; w++)
+    {
+        uint64_t bits;
+        COO_BLOCK_WORD(
+            bits, w, last, center, ~(uint64_t)0, nerr, i,
+            hco2hel_one( obj, obj, center, i, gm )
+        );
+
+        if ( mask != nullptr ) mask[w] = bits;
+    } // end for
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hco2hel_range
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_ex
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for all objects,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hco for input, obj[].hel for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hco2hel_ex(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    uint64_t       mask[],
+    uint32_t*      nfail
+    )
+{
+    return( hco2hel_ctx( nullptr, obj, dim, center, mask, nfail ) );
+} // end hco2hel_ex
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_view
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for all objects of a view,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" of type view_t for output
+ *                  (using element columns)
+ *                - pointer "src" of type view_t for input (using coordinate
+ *                  and mass columns), may be equal to "dst" for in-place
+ *                  conversion
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : same partition as hco2hel_ctx(); each object is gathered
+ *                into registers, converted, and scattered back on success
+ ******************************************************************************/
+COO_DISPATCH int hco2hel_view(
+    const coo_ctx_t*    ctx,
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      center,
+    uint64_t            mask[],
+    uint32_t*           nfail
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) || (src->dim <= center)
+         || (dst->dim != src->dim) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    const uint32_t dim = src->dim;
+
+    /* set central object to zero */
+    coo_view_set_hel( dst, center, &hel_zero );
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const double gm = coo_ctx_gm( ctx );
+    const double mc = coo_view_mass( src, center );
+
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        hco2hel_view_one( dst, src, i, gm * (mc + coo_view_mass( src, i )) )
     );
-#endif
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hco2hel_view
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_arr
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for all objects of compact
+ *                arrays, and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - array "ele" of type hel_t for output elements
+ *                - array "coo" of type hco_t for input coordinates
+ *                - array "mass" of masses
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : same partition as hco2hel_ctx()
+ ******************************************************************************/
+COO_DISPATCH int hco2hel_arr(
+    const coo_ctx_t*           ctx,
+    hel_t* COO_RESTRICT        ele,
+    const hco_t* COO_RESTRICT  coo,
+    const double* COO_RESTRICT mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    /* check input */
+    if ( (ele == nullptr) || (coo == nullptr) || (mass == nullptr)
+         || (dim <= center) )
+    {
+        /* TODO print error message */
         return 1;
     } // end if
 
-    /* mean anomaly */
-    ele->man = E - esinE;
+    /* set central object to zero */
+    ele[center] = hel_zero;
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
 
-    /* true anomaly */
-    const double e2 = ele->ecc * ele->ecc; // ecc^2
-    const double ta = atan2( sqrt(1.0 - e2) * esinE, ecosE - e2 );
+    /* settings of context */
+    const double gm = coo_ctx_gm( ctx );
 
-    /* argument of pericenter */
-    ele->aph = u - ta;
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        tm_hco2hel_core_d(
+            &ele[i], &coo[i], gm * (mass[center] + mass[i]), nullptr
+        )
+    );
 
-    /* make angles positive */
-    if (ele->inc < 0.0) ele->inc += M_2PI;
-    if (ele->aph < 0.0) ele->aph += M_2PI;
-    if (ele->lan < 0.0) ele->lan += M_2PI;
-    if (ele->man < 0.0) ele->man += M_2PI;
+    if ( nfail != nullptr ) *nfail = nerr;
 
     return 0;
-} // end hco2hel_core
+} // end hco2hel_arr
 
 /******************************************************************************/
 
@@ -153,9 +667,47 @@ int hco2hel(
     const uint32_t dim,
     const uint32_t center
     )
+{
+    return( hco2hel_ex( obj, dim, center, nullptr, nullptr ) );
+} // end hco2hel
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_jac_ctx
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for all objects, together
+ *                with the partial derivatives d(elements) / d(pos,vel),
+ *                and report objects without valid partials
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hco for input, obj[].hel for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "jac" to array of type jac_t with "dim" entries
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for objects that failed to convert or
+ *                  have no valid partials (may be nullptr)
+ *                - pointer "nfail" for number of flagged objects (may be
+ *                  nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : the partials are derived analytically from the quantities
+ *                of tm_hco2hel_core_d(), see hco2hel_core_jac(); the
+ *                Jacobian is set to zero for e or sin(inc) below
+ *                HCO2HEL_JAC_TOL
+ ******************************************************************************/
+COO_DISPATCH int hco2hel_jac_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    jac_t            jac[],
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
 {
     /* check input */
-    if ( (obj == nullptr) || (dim < center) )
+    if ( (obj == nullptr) || (jac == nullptr) || (dim <= center) )
     {
         /* TODO print error message */
         return 1;
@@ -163,21 +715,49 @@ int hco2hel(
 
     /* set central object to zero */
     obj[center].hel = hel_zero;
+    jac[center]     = jac_zero;
 
-    /* convert other objects */
-    for (register uint32_t i = 0; i < dim; i++)
-    {
-        /* skip central object */
-        if ( i == center ) continue;
+    /* number of flagged objects */
+    uint32_t nerr = 0;
 
-        /* mass parameter G(M+m), with G = gaussk2 */
-        const double mu = gaussk2 * (obj[center].mass + obj[i].mass);
+    /* settings of context */
+    const double gm = coo_ctx_gm( ctx );
 
-        /* TODO FIXME check return value for error */
-        (void)hco2hel_core( &obj[i].hel, &obj[i].hco, mu );
-    } // end for
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        hco2hel_jac_one(
+            obj, jac, i, gm * (obj[center].mass + obj[i].mass)
+        )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
 
     return 0;
-} // end hco2hel
+} // end hco2hel_jac_ctx
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hco2hel_jac
+ *  DESCRIPTION : convert from heliocentric cartesian coordinates to
+ *                heliocentric orbital elements for all objects, together
+ *                with the partial derivatives d(elements) / d(pos,vel)
+ *  INPUT       : - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hco for input, obj[].hel for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "jac" to array of type jac_t with "dim" entries
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hco2hel_jac(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    jac_t          jac[]
+    )
+{
+    return( hco2hel_jac_ctx( nullptr, obj, dim, center, jac, nullptr, nullptr ) );
+} // end hco2hel_jac
 
 /******************************************************************************/
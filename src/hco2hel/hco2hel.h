@@ -24,6 +24,10 @@ extern "C" {
 
 /*!
  * @brief convert heliocentric coordinates to heliocentric elements
+ * @details the angles and the eccentricity are computed with inline
+ * approximations of atan2() and hypot() instead of the libm functions, with
+ * errors below 1.70 and 1.25 ulp; results may thus differ from libm in the
+ * last bits. Build with COO_STRICT_MATH defined to use libm instead.
  * @param[in,out] obj array of type #body_t
  * @param[in] dim dimension of array \a obj
  * @param[in] center index of central body (for mass parameter GM)
@@ -35,6 +39,206 @@ int hco2hel(
     const uint32_t center
 );
 
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements
+ * and report objects that failed to convert
+ * @details objects with invalid input keep their previous output values
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_ex(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    uint64_t       mask[],
+    uint32_t*      nfail
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements
+ * using the settings of a conversion context
+ * @details identical to hco2hel_ex(), but with the gravitational constant
+ * and the number of threads taken from \a ctx
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements,
+ * out of place
+ * @details reads src[].hco and src[].mass, writes dst[].hel only
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] dst array of type #body_t for output
+ * @param[in] src array of type #body_t for input, must not overlap \a dst
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements
+ * for a contiguous range of objects
+ * @details serial conversion of objects first ... first + count - 1 (at most
+ * up to \a dim) in blocks of 64, see hel2hco_range()
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[in] first index of first object, multiple of 64
+ * @param[in] count number of objects, multiple of 64 unless the range
+ * reaches the end of the array (\a first + \a count >= \a dim), so that
+ * concurrent ranges never share a word of \a mask
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, only the
+ * words of the range are written (may be nullptr)
+ * @param[out] nfail number of failed objects in the range (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_range(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    const uint32_t   first,
+    const uint32_t   count,
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements
+ * in caller-owned memory
+ * @details identical to hco2hel_ctx(), but reads the coordinate and mass
+ * columns of \a src and writes the element columns of \a dst
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in] dst view of type #view_t for output
+ * @param[in] src view of type #view_t for input, may be equal to \a dst
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_view(
+    const coo_ctx_t*    ctx,
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      center,
+    uint64_t            mask[],
+    uint32_t*           nfail
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements
+ * for compact arrays
+ * @details identical to hco2hel_ctx(), but with separate arrays for input
+ * coordinates, output elements and masses instead of #body_t
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] ele array of type #hel_t for elements
+ * @param[in] coo array of type #hco_t for coordinates
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_arr(
+    const coo_ctx_t*           ctx,
+    hel_t* COO_RESTRICT        ele,
+    const hco_t* COO_RESTRICT  coo,
+    const double* COO_RESTRICT mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements
+ * and evaluate the Jacobian d(elements) / d(pos,vel)
+ * @details identical to hco2hel_jac_ctx() with default settings and
+ * without status bitmap
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] jac array of type #jac_t with \a dim entries
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_jac(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    jac_t          jac[]
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements
+ * and evaluate the Jacobian d(elements) / d(pos,vel), using the settings
+ * of a conversion context, and report objects without valid partials
+ * @details the Jacobian is set to zero and the bit in \a mask is set for
+ * objects that fail to convert, for nearly circular or planar orbits
+ * (e or sin(inc) below sqrt(DBL_EPSILON), where aph and lan are
+ * ill-defined); elements are written for all valid objects
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] jac array of type #jac_t with \a dim entries
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each object without valid partials (may be nullptr)
+ * @param[out] nfail number of objects without valid partials (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_jac_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    jac_t            jac[],
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -13,11 +13,15 @@
  ******************************************************************************/
 /* include standard headers */
 #include <math.h>
+#include <stdbool.h>
 
 /* include module headers */
 #include "hel2hco.h"
 #include "const.h"
+#include "context.h"
+#include "view.h"
 #include "kepler.h"
+#include "cvt_tmpl_d.h"
 #include "utils.h"
 #include "vec3d.h"
 
@@ -31,6 +35,34 @@
 
 /******************************************************************************/
 
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_orient
+ *  DESCRIPTION : compute orientation matrix (first two columns P, Q of the
+ *                rotation from orbital plane to reference frame) and store
+ *                the angles it was computed for
+ *  INPUT       : - pointer "rot" of type orient_t for result
+ *                - array "dinc" for derivatives dP/dinc (entries 0-2) and
+ *                  dQ/dinc (entries 3-5), may be nullptr
+ *                - pointer "ele" of type hel_t for source elements
+ *  OUTPUT      : none
+ ******************************************************************************/
+static inline void hel2hco_orient(
+    orient_t*          rot,
+    double             dinc[6],
+    const hel_t* const ele
+    )
+{
+    /* transformation matrix elements: P = (s11, s21, s31), Q = (s12, s22, s32) */
+    tm_orient_d( rot->p, rot->q, dinc, ele );
+
+    /* key of cache entry */
+    rot->inc = ele->inc;
+    rot->aph = ele->aph;
+    rot->lan = ele->lan;
+} // end hel2hco_orient
+
+/******************************************************************************/
+
 /*******************************************************************************
  *  FUNCTION    : hel2hco_core
  *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
@@ -38,69 +70,1050 @@
  *  INPUT       : - pointer of type hel_t for source elements "ele"
  *                - pointer of type hco_t for resulting coordinates "coo"
  *                - value for mass parameter mu = m0 + m(i)
+ *                - Boolean "with_vel" whether to compute velocities,
+ *                  if false only coo->pos is written
+ *                - pointer "cache" of type orient_t for the cached orientation
+ *                  matrix of this object (may be nullptr), recomputed only if
+ *                  one of the angles inc, aph, lan has changed
  *  OUTPUT      : 0 = success, 1 = error
  ******************************************************************************/
-static int hel2hco_core(
+static inline int hel2hco_core(
     hco_t*             coo,
     const hel_t* const ele,
-    const double       mu
+    const double       mu,
+    const bool         with_vel,
+    orient_t*          cache
     )
 {
-    double cosinc, sininc;   /* Inklination */
-    double cosaph, sinaph;   /* Arg. d. Perihels */
-    double coslan, sinlan;   /* Knotenlaenge */
-    double cosE, sinE;       /* exzentr. Anom. */
-    double q1, q2;
+    double p[3], q[3];
+
+    /* orientation matrix, from cache if the angles are unchanged;
+     * NaN keys of a fresh cache never compare equal
+     */
+    if ( cache == nullptr )
+    {
+        tm_orient_d( p, q, nullptr, ele );
+        return( tm_hel2hco_rot_d( coo, ele, p, q, mu, with_vel ) );
+    } // end if
 
-    /* check a > 0 */
-    if ( ele->sma <= 0.0 ) return 1;
+    if (
+        (cache->inc != ele->inc) || (cache->aph != ele->aph)
+        || (cache->lan != ele->lan)
+    )
+    {
+        hel2hco_orient( cache, nullptr, ele );
+    } // end if
 
-    /* check 0 <= ecc < 1 */
-    if ( (ele->ecc < 0.0) || (ele->ecc >= 1.0) ) return 1;
+    return( tm_hel2hco_rot_d( coo, ele, cache->p, cache->q, mu, with_vel ) );
+} // end hel2hco_core
 
-    /* TODO check e == 0, i == 0 */
+/******************************************************************************/
 
-    /* trigonometric functions of the angles ...
-     * NOTE leave last argument "-1"
-     */
-    coo_sincos( &sininc, &cosinc, ele->inc, -1.0 );
-    coo_sincos( &sinaph, &cosaph, ele->aph, -1.0 );
-    coo_sincos( &sinlan, &coslan, ele->lan, -1.0 );
-
-    /* transformation matrix elements */
-    const double s11 =  coslan * cosaph - sinlan * sinaph * cosinc;
-    const double s21 =  sinlan * cosaph + coslan * sinaph * cosinc;
-    const double s31 =  sinaph * sininc;
-    const double s12 = -coslan * sinaph - sinlan * cosaph * cosinc;
-    const double s22 = -sinlan * sinaph + coslan * cosaph * cosinc;
-    const double s32 =  cosaph * sininc;
-
-    /* eccentric anomaly via solution of Kepler's Equation;
-     * TODO FIXME use sensible default value for E as backup
-     * in case that kesolver() fails
-     */
-    const double ea = coo_kesolver( ele->ecc, ele->man ); // tmp = ...
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_core_jac
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for single object, and evaluate the
+ *                matrix of partial derivatives d(pos,vel) / d(elements)
+ *  INPUT       : - pointer of type hco_t for resulting coordinates "coo"
+ *                - pointer of type jac_t for resulting partials "jac"
+ *                - pointer of type hel_t for source elements "ele"
+ *                - value for mass parameter mu = m0 + m(i)
+ *                - value "ea" for eccentric anomaly E(ecc, man)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : position and velocity are written as
+ *                pos = X * P + Y * Q, vel = VX * P + VY * Q,
+ *                with P, Q the first two columns of the rotation matrix;
+ *                the coordinates come from tm_hel2hco_anom_d(), as in
+ *                hel2hco_core(), the partials recompute the in-plane
+ *                quantities X, Y, VX, VY for the given E
+ ******************************************************************************/
+static int hel2hco_core_jac(
+    hco_t*             coo,
+    jac_t*             jac,
+    const hel_t* const ele,
+    const double       mu,
+    const double       ea
+    )
+{
+    double   cosE, sinE;
+    double   dinc[6];
+    orient_t rot;
+
+    /* check a > 0 and 0 <= ecc < 1; NaN fails */
+    if ( !tm_hel2hco_valid_d( ele ) ) return 1;
+
+    /* orientation matrix P, Q and its derivatives with respect to inclination */
+    hel2hco_orient( &rot, dinc, ele );
+    const double* const P  = rot.p;
+    const double* const Q  = rot.q;
+    const double* const Pi = &dinc[0];
+    const double* const Qi = &dinc[3];
+
+    /* eccentric anomaly, solution of Kepler's Equation supplied by caller */
     coo_sincos( &sinE, &cosE, ea, -1.0 );
 
-    /* Cartesian coordinates */
-    const double tmpe = sqrt(1.0 - ele->ecc * ele->ecc);
-    q1 = ele->sma * (cosE - ele->ecc);
-    q2 = ele->sma * tmpe * sinE;
-    coo->pos.x = s11 * q1 + s12 * q2;
-    coo->pos.y = s21 * q1 + s22 * q2;
-    coo->pos.z = s31 * q1 + s32 * q2;
-
-    /* Cartesian velocities */
-    //q1 = gaussk * sqrt(mu) / ((1.0 - ele->ecc * cosE) * sqrt(ele->sma));
-    q1  = sqrt( mu ) / ((1.0 - ele->ecc * cosE) * sqrt( ele->sma ));
-    q2  = q1 * tmpe * cosE;
-    q1 *= -sinE;
-    coo->vel.x = s11 * q1 + s12 * q2;
-    coo->vel.y = s21 * q1 + s22 * q2;
-    coo->vel.z = s31 * q1 + s32 * q2;
+    /* orbital plane coordinates and velocities */
+    const double a    = ele->sma;
+    const double e    = ele->ecc;
+    const double tmpe = sqrt((1.0 - e) * (1.0 + e)); // beta = (1 - e^2)^1/2
+    const double den  = 1.0 / (1.0 - e * cosE); // 1 / D
+    const double vfac = sqrt( mu ) / sqrt( a ); // (mu / a)^1/2
+    const double X    = a * (cosE - e);
+    const double Y    = a * tmpe * sinE;
+    const double VX   = -vfac * sinE * den;
+    const double VY   =  vfac * tmpe * cosE * den;
+
+    /* coordinates, identical to hel2hco_core() */
+    tm_hel2hco_anom_d( coo, ele, P, Q, mu, true, sinE, cosE );
+
+    /* partials of (X, Y, VX, VY) with respect to eccentric anomaly */
+    const double den2 = den * den;
+    const double XE   = -a * sinE;
+    const double YE   =  a * tmpe * cosE;
+    const double VXE  = -vfac * (cosE - e) * den2;
+    const double VYE  = -vfac * tmpe * sinE * den2;
+
+    /* dE/de = sinE / D, dE/dM = 1 / D */
+    const double Ee = sinE * den;
+    const double EM = den;
+
+    /* in-plane partials: d/da, d/de (total), d/dM */
+    const double dq[4][3] = {
+        /*  d/da            d/de                                                  d/dM  */
+        { X / a,         -a + XE * Ee,                                            XE  * EM },
+        { Y / a,         -a * e * sinE / tmpe + YE * Ee,                          YE  * EM },
+        { -0.5 * VX / a, -vfac * sinE * cosE * den2 + VXE * Ee,                   VXE * EM },
+        { -0.5 * VY / a,  vfac * cosE * (tmpe * cosE * den2 - e * den / tmpe) + VYE * Ee, VYE * EM },
+    };
+
+    for (register int k = 0; k < 3; k++)
+    {
+        /* dP/dlan = (-P2, P1, 0), dQ/dlan = (-Q2, Q1, 0) */
+        const double Pl = (k == 0) ? -P[1] : ((k == 1) ? P[0] : 0.0);
+        const double Ql = (k == 0) ? -Q[1] : ((k == 1) ? Q[0] : 0.0);
+
+        /* position row k */
+        double* row = jac->m[k];
+        row[0] = P[k] * dq[0][0] + Q[k] * dq[1][0];
+        row[1] = P[k] * dq[0][1] + Q[k] * dq[1][1];
+        row[2] = Pi[k] * X + Qi[k] * Y;
+        row[3] = Q[k] * X - P[k] * Y;       // dP/daph = Q, dQ/daph = -P
+        row[4] = Pl * X + Ql * Y;
+        row[5] = P[k] * dq[0][2] + Q[k] * dq[1][2];
+
+        /* velocity row k+3 */
+        row = jac->m[k + 3];
+        row[0] = P[k] * dq[2][0] + Q[k] * dq[3][0];
+        row[1] = P[k] * dq[2][1] + Q[k] * dq[3][1];
+        row[2] = Pi[k] * VX + Qi[k] * VY;
+        row[3] = Q[k] * VX - P[k] * VY;
+        row[4] = Pl * VX + Ql * VY;
+        row[5] = P[k] * dq[2][2] + Q[k] * dq[3][2];
+    } // end for
 
     return 0;
-} // end hel2hco_core
+} // end hel2hco_core_jac
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_one
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for single object of an array
+ *  INPUT       : - pointer "dst" to array of type body_t for output
+ *                  (using members dst[].hco)
+ *                - pointer "src" to array of type body_t for input
+ *                  (using members src[].hel and src[].mass), may be equal
+ *                  to "dst"
+ *                - index "center" for central body
+ *                - index "i" of object
+ *                - value "gm" for gravitational constant
+ *                - Boolean "with_vel" whether to compute velocities
+ *                - array "cache" of type orient_t with "dim" entries for
+ *                  cached orientation matrices (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+static inline int hel2hco_one(
+    body_t*        dst,
+    const body_t*  src,
+    const uint32_t center,
+    const uint32_t i,
+    const double   gm,
+    const bool     with_vel,
+    orient_t       cache[]
+    )
+{
+    /* mass parameter G(M+m) */
+    const double mu = gm * (src[center].mass + src[i].mass);
+
+    return( hel2hco_core(
+        &dst[i].hco, &src[i].hel, mu, with_vel,
+        (cache != nullptr) ? &cache[i] : nullptr
+    ) );
+} // end hel2hco_one
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_view_one
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for single object of a view
+ *  INPUT       : - pointer "dst" of type view_t for output
+ *                - pointer "src" of type view_t for input, may be equal to
+ *                  "dst"
+ *                - index "i" of object
+ *                - value for mass parameter mu = m0 + m(i)
+ *                - Boolean "with_vel" whether to compute velocities
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : the object is gathered into registers, converted, and
+ *                scattered back on success
+ ******************************************************************************/
+static inline int hel2hco_view_one(
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      i,
+    const double        mu,
+    const bool          with_vel
+    )
+{
+    hel_t ele;
+    hco_t coo;
+    coo_view_get_hel( &ele, src, i );
+
+    /* keep previous output of failed conversion */
+    const int err = hel2hco_core( &coo, &ele, mu, with_vel, nullptr );
+    if ( err == 0 ) coo_view_set_hco( dst, i, &coo, with_vel );
+
+    return err;
+} // end hel2hco_view_one
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_jac_one
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for single object, together with the
+ *                partial derivatives d(pos,vel) / d(elements)
+ *  INPUT       : - pointer "obj" to array of type body_t for coordinates
+ *                - pointer "jac" to array of type jac_t for partials
+ *                - index "i" of object
+ *                - value for mass parameter mu = m0 + m(i)
+ *  OUTPUT      : 0 = success, 1 = error (invalid elements, obj[i].hco is
+ *                kept and jac[i] is set to zero)
+ ******************************************************************************/
+static inline int hel2hco_jac_one(
+    body_t         obj[],
+    jac_t          jac[],
+    const uint32_t i,
+    const double   mu
+    )
+{
+    /* no partials for invalid elements, keep previous output;
+     * checked before Kepler's Equation is solved
+     */
+    hco_t tmp;
+    if (
+        !tm_hel2hco_valid_d( &obj[i].hel )
+        || (hel2hco_core_jac(
+                &tmp, &jac[i], &obj[i].hel, mu,
+                coo_kesolver( obj[i].hel.ecc, obj[i].hel.man )
+            ) != 0)
+    )
+    {
+        jac[i] = jac_zero;
+        return 1;
+    } // end if
+
+    obj[i].hco = tmp;
+
+    return 0;
+} // end hel2hco_jac_one
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_block
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr for
+ *                  default settings: G = gaussk2, serial loop)
+ *                - pointer "dst" to array of type body_t for output
+ *                  (using members dst[].hco)
+ *                - pointer "src" to array of type body_t for input
+ *                  (using members src[].hel and src[].mass), may be equal
+ *                  to "dst" for in-place conversion (hence not restrict)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *                - Boolean "with_vel" whether to compute velocities
+ *                - array "cache" of type orient_t with "dim" entries for
+ *                  cached orientation matrices (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : objects are processed in blocks of 64, matching one word
+ *                of the bitmap, so that each word is written only once;
+ *                blocks are distributed over the threads of the context
+ ******************************************************************************/
+COO_DISPATCH static int hel2hco_block(
+    const coo_ctx_t* ctx,
+    body_t*          dst,
+    const body_t*    src,
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail,
+    const bool       with_vel,
+    orient_t         cache[]
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* set central object to zero */
+    if ( with_vel ) dst[center].hco     = hco_zero;
+    else            dst[center].hco.pos = hco_zero.pos;
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const double gm = coo_ctx_gm( ctx );
+
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        hel2hco_one( dst, src, center, i, gm, with_vel, cache )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hel2hco_block
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_block_oop
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects, out of place,
+ *                and report objects with invalid input
+ *  INPUT       : see hel2hco_block(), but "dst" and "src" must not overlap,
+ *                and without cached orientation matrices
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : same loop as hel2hco_block(), instantiated with restrict
+ *                pointers, so that src[] need not be reloaded after each
+ *                store to dst[]
+ ******************************************************************************/
+COO_DISPATCH static int hel2hco_block_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail,
+    const bool                 with_vel
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* set central object to zero */
+    if ( with_vel ) dst[center].hco     = hco_zero;
+    else            dst[center].hco.pos = hco_zero.pos;
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const double gm = coo_ctx_gm( ctx );
+
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        hel2hco_one( dst, src, center, i, gm, with_vel, nullptr )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hel2hco_block_oop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_ctx
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
+{
+    return( hel2hco_block(
+        ctx, obj, obj, dim, center, mask, nfail, true, nullptr
+    ) );
+} // end hel2hco_ctx
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_ex
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_ex(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    uint64_t       mask[],
+    uint32_t*      nfail
+    )
+{
+    return( hel2hco_ctx( nullptr, obj, dim, center, mask, nfail ) );
+} // end hel2hco_ex
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_pos_ctx
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian positions for all objects, skipping velocities,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco.pos for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_pos_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
+{
+    return( hel2hco_block(
+        ctx, obj, obj, dim, center, mask, nfail, false, nullptr
+    ) );
+} // end hel2hco_pos_ctx
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_pos_ex
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian positions for all objects, skipping velocities,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco.pos for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_pos_ex(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    uint64_t       mask[],
+    uint32_t*      nfail
+    )
+{
+    return( hel2hco_pos_ctx( nullptr, obj, dim, center, mask, nfail ) );
+} // end hel2hco_pos_ex
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_oop
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects, out of place,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" to array of type body_t for output
+ *                  (using members dst[].hco, other members are not touched)
+ *                - pointer "src" to array of type body_t for input
+ *                  (using members src[].hel and src[].mass), must not
+ *                  overlap with "dst"
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    return( hel2hco_block_oop(
+        ctx, dst, src, dim, center, mask, nfail, true
+    ) );
+} // end hel2hco_oop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_pos_oop
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian positions only for all objects, out of place,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" to array of type body_t for output
+ *                  (using members dst[].hco.pos, other members are not touched)
+ *                - pointer "src" to array of type body_t for input
+ *                  (using members src[].hel and src[].mass), must not
+ *                  overlap with "dst"
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_pos_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    return( hel2hco_block_oop(
+        ctx, dst, src, dim, center, mask, nfail, false
+    ) );
+} // end hel2hco_pos_oop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_range
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for a contiguous range of objects,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - index "first" of first object, multiple of 64
+ *                - number "count" of objects, multiple of 64 unless the
+ *                  range reaches the end of the array (first+count >= dim)
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, only the words of the range are written
+ *                  (may be nullptr)
+ *                - pointer "nfail" for number of failed objects in the range
+ *                  (may be nullptr)
+ *                - Boolean "with_vel" whether to compute velocities
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : serial loop over the blocks of hel2hco_block(), for callers
+ *                that distribute the blocks of an array themselves; ranges
+ *                that start at distinct multiples of 64 may be converted
+ *                concurrently, the thread settings of "ctx" are ignored
+ ******************************************************************************/
+COO_DISPATCH int hel2hco_range(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    const uint32_t   first,
+    const uint32_t   count,
+    uint64_t         mask[],
+    uint32_t*        nfail,
+    const bool       with_vel
+    )
+{
+    /* check input */
+    if ( (obj == nullptr) || (dim <= center) || (first % 64u != 0) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* a range ending inside a block would share its word with the next */
+    if ( (count % 64u != 0) && (first < dim) && (count < dim - first) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* range of blocks */
+    const uint32_t last = (first >= dim)         ? first
+                        : (count < dim - first) ? first + count : dim;
+    const uint32_t w0   = first / 64u;
+    const uint32_t w1   = COO_MASK_WORDS(last);
+
+    /* set central object to zero, if part of the range */
+    if ( (center >= first) && (center < last) )
+    {
+        if ( with_vel ) obj[center].hco     = hco_zero;
+        else            obj[center].hco.pos = hco_zero.pos;
+    } // end if
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* convert objects, block-wise */
+    const double gm = coo_ctx_gm( ctx );
+    for (register uint32_t w = w0; w < w1; w++)
+    {
+        uint64_t bits;
+        COO_BLOCK_WORD(
+            bits, w, last, center, ~(uint64_t)0, nerr, i,
+            hel2hco_one( obj, obj, center, i, gm, with_vel, nullptr )
+        );
+
+        if ( mask != nullptr ) mask[w] = bits;
+    } // end for
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hel2hco_range
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_view_block
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects of a view,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" of type view_t for output
+ *                  (using coordinate columns)
+ *                - pointer "src" of type view_t for input (using element
+ *                  and mass columns), may be equal to "dst" for in-place
+ *                  conversion
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *                - Boolean "with_vel" whether to compute velocities
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : same partition as hel2hco_block(); each object is gathered
+ *                into registers, converted, and scattered back on success
+ ******************************************************************************/
+COO_DISPATCH static int hel2hco_view_block(
+    const coo_ctx_t*    ctx,
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      center,
+    uint64_t            mask[],
+    uint32_t*           nfail,
+    const bool          with_vel
+    )
+{
+    /* check input */
+    if ( (dst == nullptr) || (src == nullptr) || (src->dim <= center)
+         || (dst->dim != src->dim) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    const uint32_t dim = src->dim;
+
+    /* set central object to zero */
+    coo_view_set_hco( dst, center, &hco_zero, with_vel );
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const double gm = coo_ctx_gm( ctx );
+    const double mc = coo_view_mass( src, center );
+
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        hel2hco_view_one(
+            dst, src, i, gm * (mc + coo_view_mass( src, i )), with_vel
+        )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hel2hco_view_block
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_view
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects of a view,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" of type view_t for output
+ *                - pointer "src" of type view_t for input
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_view(
+    const coo_ctx_t*    ctx,
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      center,
+    uint64_t            mask[],
+    uint32_t*           nfail
+    )
+{
+    return( hel2hco_view_block( ctx, dst, src, center, mask, nfail, true ) );
+} // end hel2hco_view
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_pos_view
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian positions only for all objects of a view,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "dst" of type view_t for output
+ *                  (velocity columns are not written)
+ *                - pointer "src" of type view_t for input
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_pos_view(
+    const coo_ctx_t*    ctx,
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      center,
+    uint64_t            mask[],
+    uint32_t*           nfail
+    )
+{
+    return( hel2hco_view_block( ctx, dst, src, center, mask, nfail, false ) );
+} // end hel2hco_pos_view
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_arr_block
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects of compact arrays,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - array "coo" of type hco_t for output coordinates
+ *                - array "ele" of type hel_t for input elements
+ *                - array "mass" of masses
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *                - Boolean "with_vel" whether to compute velocities
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : same partition as hel2hco_block()
+ ******************************************************************************/
+COO_DISPATCH static int hel2hco_arr_block(
+    const coo_ctx_t*           ctx,
+    hco_t* COO_RESTRICT        coo,
+    const hel_t* COO_RESTRICT  ele,
+    const double* COO_RESTRICT mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail,
+    const bool                 with_vel
+    )
+{
+    /* check input */
+    if ( (coo == nullptr) || (ele == nullptr) || (mass == nullptr)
+         || (dim <= center) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* set central object to zero */
+    if ( with_vel ) coo[center]     = hco_zero;
+    else            coo[center].pos = hco_zero.pos;
+
+    /* number of failed objects */
+    uint32_t nerr = 0;
+
+    /* settings of context */
+    const double gm = coo_ctx_gm( ctx );
+
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        hel2hco_core(
+            &coo[i], &ele[i], gm * (mass[center] + mass[i]), with_vel, nullptr
+        )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
+
+    return 0;
+} // end hel2hco_arr_block
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_arr
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects of compact arrays,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - array "coo" of type hco_t for output coordinates
+ *                - array "ele" of type hel_t for input elements
+ *                - array "mass" of masses
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_arr(
+    const coo_ctx_t*           ctx,
+    hco_t* COO_RESTRICT        coo,
+    const hel_t* COO_RESTRICT  ele,
+    const double* COO_RESTRICT mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    return( hel2hco_arr_block(
+        ctx, coo, ele, mass, dim, center, mask, nfail, true
+    ) );
+} // end hel2hco_arr
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_pos_arr
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian positions only for all objects of compact arrays,
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - array "coo" of type hco_t for output positions
+ *                  (members coo[].vel are not written)
+ *                - array "ele" of type hel_t for input elements
+ *                - array "mass" of masses
+ *                - dimension "dim" of arrays
+ *                - index "center" for central body
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_pos_arr(
+    const coo_ctx_t*           ctx,
+    hco_t* COO_RESTRICT        coo,
+    const hel_t* COO_RESTRICT  ele,
+    const double* COO_RESTRICT mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+    )
+{
+    return( hel2hco_arr_block(
+        ctx, coo, ele, mass, dim, center, mask, nfail, false
+    ) );
+} // end hel2hco_pos_arr
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_orient_init
+ *  DESCRIPTION : invalidate all entries of an orientation matrix cache
+ *  INPUT       : - array "cache" of type orient_t
+ *                - dimension "dim" of array
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_orient_init(
+    orient_t       cache[],
+    const uint32_t dim
+    )
+{
+    if ( cache == nullptr ) return;
+
+    for (register uint32_t i = 0; i < dim; i++)
+    {
+        /* NaN never compares equal, forces recomputation */
+        cache[i].inc = NAN;
+        cache[i].aph = NAN;
+        cache[i].lan = NAN;
+    } // end for
+
+    return;
+} // end coo_orient_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_cached
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects, re-using cached
+ *                orientation matrices of objects whose angles inc, aph, lan
+ *                did not change since the previous call
+ *  INPUT       : - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - array "cache" of type orient_t with "dim" entries,
+ *                  initialised with coo_orient_init()
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_cached(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    orient_t       cache[],
+    uint64_t       mask[],
+    uint32_t*      nfail
+    )
+{
+    if ( cache == nullptr ) return 1;
+
+    return( hel2hco_block(
+        nullptr, obj, obj, dim, center, mask, nfail, true, cache
+    ) );
+} // end hel2hco_cached
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_epochs
+ *  DESCRIPTION : convert heliocentric orbital elements of a single object to
+ *                heliocentric cartesian coordinates at several epochs;
+ *                the orientation matrix is computed once, and each Kepler
+ *                Equation is warm-started from the previous epoch
+ *  INPUT       : - array "coo" of type hco_t with "num" entries for output
+ *                - pointer "ele" to elements of type hel_t, valid at t = 0
+ *                - value "mm" for mean motion n = (mu / a^3)^1/2 in rad/day
+ *                - array "t" of times in days relative to epoch of "ele"
+ *                - number "num" of epochs
+ *  OUTPUT      : 0 = success, 1 = error
+ *  NOTE        : the mass parameter follows from Kepler's third law,
+ *                mu = n^2 a^3; warm starts pay off most for ordered times
+ *                with small steps in mean anomaly
+ ******************************************************************************/
+COO_DISPATCH int hel2hco_epochs(
+    hco_t              coo[],
+    const hel_t* const ele,
+    const double       mm,
+    const double       t[],
+    const uint32_t     num
+    )
+{
+    double   cosE = 1.0, sinE = 0.0;
+    orient_t rot;
+
+    /* check input */
+    if ( (coo == nullptr) || (ele == nullptr) || (t == nullptr) )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    /* check a > 0, 0 <= ecc < 1, n > 0; NaN fails */
+    if ( !tm_hel2hco_valid_d( ele ) || !(mm > 0.0) ) return 1;
+
+    /* orientation matrix, once for all epochs */
+    hel2hco_orient( &rot, nullptr, ele );
+
+    /* constants of the orbit, mass parameter mu = n^2 a^3 */
+    const double ecc = ele->ecc;
+    const double na  = mm * ele->sma;
+    const double mu  = na * na * ele->sma;
+
+    /* state of previous epoch, for warm start */
+    double ma_prev = 0.0;
+    double ea      = 0.0;
+
+    for (register uint32_t k = 0; k < num; k++)
+    {
+        const double ma = ele->man + mm * t[k];
+
+        /* eccentric anomaly: cold start for first epoch, otherwise
+         * first order prediction dE = dM / (1 - e cos E) as initial guess
+         */
+        if ( k == 0 )
+        {
+            ea = coo_kesolver( ecc, ma );
+        } // end if
+        else
+        {
+            const double guess = ea + (ma - ma_prev) / (1.0 - ecc * cosE);
+            ea = coo_kesolver_ws( ecc, ma, guess );
+        } // end else
+        ma_prev = ma;
+        coo_sincos( &sinE, &cosE, ea, -1.0 );
+
+        /* Cartesian coordinates and velocities, as in hel2hco_core() */
+        tm_hel2hco_anom_d( &coo[k], ele, rot.p, rot.q, mu, true, sinE, cosE );
+    } // end for
+
+    return 0;
+} // end hel2hco_epochs
 
 /******************************************************************************/
 
@@ -119,9 +1132,41 @@ int hel2hco(
     const uint32_t dim,
     const uint32_t center
     )
+{
+    return( hel2hco_ex( obj, dim, center, nullptr, nullptr ) );
+} // end hel2hco
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_jac_ctx
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects, together with the
+ *                partial derivatives d(pos,vel) / d(elements),
+ *                and report objects with invalid input
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
+ *                - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "jac" to array of type jac_t with "dim" entries
+ *                - pointer "mask" to status bitmap with COO_MASK_WORDS(dim)
+ *                  entries, bit set for failed objects (may be nullptr)
+ *                - pointer "nfail" for number of failed objects (may be nullptr)
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+COO_DISPATCH int hel2hco_jac_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    jac_t            jac[],
+    uint64_t         mask[],
+    uint32_t*        nfail
+    )
 {
     /* check input */
-    if ( (obj == nullptr) || (dim < center) )
+    if ( (obj == nullptr) || (jac == nullptr) || (dim <= center) )
     {
         /* TODO print error message */
         return 1;
@@ -129,21 +1174,49 @@ int hel2hco(
 
     /* set central object to zero */
     obj[center].hco = hco_zero;
+    jac[center]     = jac_zero;
 
-    /* convert other objects */
-    for (register uint32_t i = 0; i < dim; i++)
-    {
-        /* skip central object */
-        if ( i == center ) continue;
+    /* number of failed objects */
+    uint32_t nerr = 0;
 
-        /* mass parameter G(M+m), with G = gaussk2 */
-        const double mu = gaussk2 * (obj[center].mass + obj[i].mass);
+    /* settings of context */
+    const double gm = coo_ctx_gm( ctx );
 
-        /* TODO FIXME check return value for error */
-        (void)hel2hco_core( &obj[i].hco, &obj[i].hel, mu );
-    } // end for
+    /* convert other objects, block-wise */
+    COO_BLOCK_LOOP(
+        ctx, dim, center, false, mask, nerr, i,
+        hel2hco_jac_one(
+            obj, jac, i, gm * (obj[center].mass + obj[i].mass)
+        )
+    );
+
+    if ( nfail != nullptr ) *nfail = nerr;
 
     return 0;
-} // end hel2hco
+} // end hel2hco_jac_ctx
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hel2hco_jac
+ *  DESCRIPTION : convert from heliocentric orbital elements to heliocentric
+ *                cartesian coordinates for all objects, together with the
+ *                partial derivatives d(pos,vel) / d(elements)
+ *  INPUT       : - pointer "obj" to array of type body_t for coordinates
+ *                  (using members obj[].hel for input, obj[].hco for output)
+ *                - dimension "dim" of array
+ *                - index "center" for central body
+ *                - pointer "jac" to array of type jac_t with "dim" entries
+ *  OUTPUT      : 0 = success, 1 = error
+ ******************************************************************************/
+int hel2hco_jac(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    jac_t          jac[]
+    )
+{
+    return( hel2hco_jac_ctx( nullptr, obj, dim, center, jac, nullptr, nullptr ) );
+} // end hel2hco_jac
 
 /******************************************************************************/
@@ -11,6 +11,9 @@
 
 /*** include prerequisite headers ***/
 
+/* standard headers */
+#include <stdbool.h>
+
 /* project headers */
 #include "types.h"
 
@@ -24,6 +27,10 @@ extern "C" {
 
 /*!
  * @brief convert heliocentric elements to heliocentric coordinates
+ * @details the starting value of the solver of Kepler's Equation uses an
+ * inline approximation of cbrt() instead of the libm function, with errors
+ * below 0.74 ulp; results may thus differ from libm in the last bits. Build
+ * with COO_STRICT_MATH defined to use libm instead.
  * @param[in,out] obj array of type #body_t
  * @param[in] dim dimension of array \a obj
  * @param[in] center index of central body (for mass parameter GM)
@@ -35,6 +42,391 @@ int hel2hco(
     const uint32_t center
 );
 
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * and report objects that failed to convert
+ * @details objects with invalid input keep their previous output values
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_ex(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    uint64_t       mask[],
+    uint32_t*      nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * using the settings of a conversion context
+ * @details identical to hel2hco_ex(), but with the gravitational constant
+ * and the number of threads taken from \a ctx
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric positions only
+ * and report objects that failed to convert
+ * @details velocities obj[].hco.vel are neither computed nor written;
+ * objects with invalid input keep their previous output values
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_pos_ex(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    uint64_t       mask[],
+    uint32_t*      nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric positions only
+ * using the settings of a conversion context
+ * @details identical to hel2hco_pos_ex(), but with the gravitational
+ * constant and the number of threads taken from \a ctx
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_pos_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates,
+ * out of place
+ * @details reads src[].hel and src[].mass, writes dst[].hco only
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] dst array of type #body_t for output
+ * @param[in] src array of type #body_t for input, must not overlap \a dst
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric positions only,
+ * out of place
+ * @details reads src[].hel and src[].mass, writes dst[].hco.pos only
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] dst array of type #body_t for output
+ * @param[in] src array of type #body_t for input, must not overlap \a dst
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_pos_oop(
+    const coo_ctx_t*           ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * for a contiguous range of objects
+ * @details serial conversion of objects first ... first + count - 1 (at most
+ * up to \a dim) in blocks of 64; ranges starting at distinct multiples of 64
+ * can be converted concurrently by the caller, the thread settings of
+ * \a ctx are ignored
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[in] first index of first object, multiple of 64
+ * @param[in] count number of objects, multiple of 64 unless the range
+ * reaches the end of the array (\a first + \a count >= \a dim), so that
+ * concurrent ranges never share a word of \a mask
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, only the
+ * words of the range are written (may be nullptr)
+ * @param[out] nfail number of failed objects in the range (may be nullptr)
+ * @param[in] with_vel whether to compute velocities obj[].hco.vel
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_range(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    const uint32_t   first,
+    const uint32_t   count,
+    uint64_t         mask[],
+    uint32_t*        nfail,
+    const bool       with_vel
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * in caller-owned memory
+ * @details identical to hel2hco_ctx(), but reads the element and mass
+ * columns of \a src and writes the coordinate columns of \a dst
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in] dst view of type #view_t for output
+ * @param[in] src view of type #view_t for input, may be equal to \a dst
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_view(
+    const coo_ctx_t*    ctx,
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      center,
+    uint64_t            mask[],
+    uint32_t*           nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric positions only
+ * in caller-owned memory
+ * @details identical to hel2hco_pos_ctx(), but reads the element and mass
+ * columns of \a src and writes the position columns of \a dst
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in] dst view of type #view_t for output
+ * @param[in] src view of type #view_t for input, may be equal to \a dst
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_pos_view(
+    const coo_ctx_t*    ctx,
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      center,
+    uint64_t            mask[],
+    uint32_t*           nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * for compact arrays
+ * @details identical to hel2hco_ctx(), but with separate arrays for input
+ * elements, output coordinates and masses instead of #body_t
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] coo array of type #hco_t for coordinates
+ * @param[in] ele array of type #hel_t for elements
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_arr(
+    const coo_ctx_t*           ctx,
+    hco_t* COO_RESTRICT        coo,
+    const hel_t* COO_RESTRICT  ele,
+    const double* COO_RESTRICT mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric positions only
+ * for compact arrays
+ * @details identical to hel2hco_pos_ctx(), but with separate arrays for
+ * input elements, output positions and masses instead of #body_t
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] coo array of type #hco_t for positions (coo[].vel unused)
+ * @param[in] ele array of type #hel_t for elements
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_pos_arr(
+    const coo_ctx_t*           ctx,
+    hco_t* COO_RESTRICT        coo,
+    const hel_t* COO_RESTRICT  ele,
+    const double* COO_RESTRICT mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief invalidate all entries of an orientation matrix cache
+ * @param[out] cache array of type #orient_t
+ * @param[in] dim dimension of array \a cache
+ * @return none
+ */
+void coo_orient_init(
+    orient_t       cache[],
+    const uint32_t dim
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates using
+ * cached orientation matrices
+ * @details for objects whose angles inc, aph, lan are unchanged since the
+ * previous call, the six trigonometric evaluations are skipped; results are
+ * identical to hel2hco_ex()
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[in,out] cache array of type #orient_t with \a dim entries,
+ * initialised with coo_orient_init()
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_cached(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    orient_t       cache[],
+    uint64_t       mask[],
+    uint32_t*      nfail
+);
+
+
+/*!
+ * @brief convert elements of a single object to heliocentric coordinates
+ * at several epochs
+ * @details the orientation matrix is computed once and each Kepler Equation
+ * is warm-started from the previous epoch, fastest for ordered times; the
+ * mean anomaly at time t[k] is ele->man + mm * t[k]
+ * @param[out] coo array of type #hco_t with \a num entries
+ * @param[in] ele elements of type #hel_t, valid at t = 0
+ * @param[in] mm mean motion n = (mu / a^3)^1/2 in radians per day
+ * @param[in] t array of times in days relative to the epoch of \a ele
+ * @param[in] num number of epochs
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_epochs(
+    hco_t              coo[],
+    const hel_t* const ele,
+    const double       mm,
+    const double       t[],
+    const uint32_t     num
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * and evaluate the Jacobian d(pos,vel) / d(elements)
+ * @details identical to hel2hco_jac_ctx() with default settings and
+ * without status bitmap
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] jac array of type #jac_t with \a dim entries
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_jac(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    jac_t          jac[]
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * and evaluate the Jacobian d(pos,vel) / d(elements), using the settings
+ * of a conversion context, and report objects that failed to convert
+ * @details for objects with invalid elements the Jacobian is set to zero
+ * and the coordinates keep their previous values
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] jac array of type #jac_t with \a dim entries
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_jac_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    jac_t            jac[],
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -31,6 +31,7 @@
 /* include module headers */
 #include "io.h"
 #include "const.h"
+#include "trace.h"
 
 /******************************************************************************/
 
@@ -146,6 +147,8 @@ int coo_read_COO(
         return 0;
     } // end if
 
+    COO_TRACE_BEGIN( "coo_read_COO", dim );
+
     register uint32_t i;
     hco_t*            p = nullptr;
 
@@ -172,6 +175,7 @@ int coo_read_COO(
             case COO_NONE:
             default:
                 /* TODO FIXME print error message */
+                COO_TRACE_END( "coo_read_COO", i );
                 return 0;
         } // end switch
 
@@ -193,6 +197,8 @@ int coo_read_COO(
         while ( fgetc(fp) != '\n' );
     } // end for
 
+    COO_TRACE_END( "coo_read_COO", i );
+
     return( (int)i );
 } // end coo_read_COO
 
@@ -222,6 +228,8 @@ int coo_read_DEL(
         return 0;
     } // end if
 
+    COO_TRACE_BEGIN( "coo_read_DEL", dim );
+
     register uint32_t i;
 
     for (i = 0; i < dim; i++)
@@ -252,6 +260,8 @@ int coo_read_DEL(
         while ( fgetc(fp) != '\n' );
     } // end for
 
+    COO_TRACE_END( "coo_read_DEL", i );
+
     return( (int)i );
 } // end coo_read_DEL
 
@@ -281,6 +291,8 @@ int coo_read_HEL(
         return 0;
     } // end if
 
+    COO_TRACE_BEGIN( "coo_read_HEL", dim );
+
     register uint32_t i;
 
     for (i = 0; i < dim; i++)
@@ -312,6 +324,8 @@ int coo_read_HEL(
         while ( fgetc(fp) != '\n' );
     } // end for
 
+    COO_TRACE_END( "coo_read_HEL", i );
+
     return( (int)i );
 } // end coo_read_HEL
 
@@ -339,6 +353,8 @@ int coo_read_RCO(
         return 0;
     } // end if
 
+    COO_TRACE_BEGIN( "coo_read_RCO", dim );
+
     register uint32_t i;
 
     for (i = 0; i < dim; i++)
@@ -363,6 +379,8 @@ int coo_read_RCO(
         while ( fgetc(fp) != '\n' );
     } // end for
 
+    COO_TRACE_END( "coo_read_RCO", i );
+
     return( (int)i );
 } // end coo_read_RCO
 
@@ -391,6 +409,8 @@ int coo_show_COO(
         return 0;
     } // end if
 
+    COO_TRACE_BEGIN( "coo_show_COO", dim );
+
     const hco_t* p = nullptr;
 
     for (register uint32_t i = 0; i < dim; i++)
@@ -416,6 +436,7 @@ int coo_show_COO(
             case COO_NONE:
             default:
                 /* TODO FIXME print error message */
+                COO_TRACE_END( "coo_show_COO", i );
                 return 0;
         } // end switch
 
@@ -432,6 +453,8 @@ int coo_show_COO(
         );
     } // end for
 
+    COO_TRACE_END( "coo_show_COO", dim );
+
     return 1;
 } // end coo_show_COO
 
@@ -460,6 +483,8 @@ int coo_show_DEL(
         return 0;
     } // end if
 
+    COO_TRACE_BEGIN( "coo_show_DEL", dim );
+
     for (register uint32_t i = 0; i < dim; i++)
     {
         del_t tmp = obj[i].del;
@@ -485,6 +510,8 @@ int coo_show_DEL(
         );
     } // end for
 
+    COO_TRACE_END( "coo_show_DEL", dim );
+
     return 1;
 } // end coo_show_DEL
 
@@ -513,6 +540,8 @@ int coo_show_HEL(
         return 0;
     } // end if
 
+    COO_TRACE_BEGIN( "coo_show_HEL", dim );
+
     for (register uint32_t i = 0; i < dim; i++)
     {
         hel_t tmp = obj[i].hel;
@@ -539,6 +568,8 @@ int coo_show_HEL(
         );
     } // end for
 
+    COO_TRACE_END( "coo_show_HEL", dim );
+
     return 1;
 } // end coo_show_HEL
 
@@ -565,6 +596,8 @@ int coo_show_RCO(
         return 0;
     } // end if
 
+    COO_TRACE_BEGIN( "coo_show_RCO", dim );
+
     for (register uint32_t i = 0; i < dim; i++)
     {
         fprintf(
@@ -582,6 +615,8 @@ int coo_show_RCO(
         );
     } // end for
 
+    COO_TRACE_END( "coo_show_RCO", dim );
+
     return 1;
 } // end coo_show_RCO
 
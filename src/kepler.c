@@ -29,11 +29,14 @@
  *
  ******************************************************************************/
 /* include standard headers */
+#include <float.h>
 #include <math.h>
 
 /* include module headers */
+#include "types.h"
 #include "kepler.h"
 #include "const.h"
+#include "cvt_tmpl_d.h"
 
 /******************************************************************************/
 
@@ -47,29 +50,6 @@
 
 /******************************************************************************/
 
-/*** internal constants ***/
-
-/* to avoid division by zero */
-static const double addzero = 1.0e-19;
-
-/******************************************************************************/
-
-/*******************************************************************************
- *  FUNCTION    : reduce
- *  DESCRIPTION : reduce input by mod(2*pi) to interval -pi <= x < pi
- *  INPUT       : angle x in radians
- *  OUTPUT      : reduced angle
- ******************************************************************************/
-static inline double reduce(double x)
-{
-    x -= floor(x / M_2PI) * M_2PI;
-    if (x >  M_PI) x -= M_2PI;
-    if (x < -M_PI) x += M_2PI;
-    return( x );
-} // end reduce
-
-/******************************************************************************/
-
 /*******************************************************************************
  *  FUNCTION    : coo_sincos
  *  DESCRIPTION : evaluate sin(x), cos(x) simultaneously;
@@ -80,6 +60,7 @@ static inline double reduce(double x)
  *                - angle x in radians
  *                - value "ecc" for extra multiplication
  *  OUTPUT      : none
+ *  NOTE        : via tan(x/2), see tm_sincos() in cvt_tmpl.h
  ******************************************************************************/
 inline void coo_sincos(
     double*      sx,
@@ -88,18 +69,7 @@ inline void coo_sincos(
     const double ecc
     )
 {
-    const double tx  = tan(0.5 * x);          // tan(x/2)
-    const double den = 1.0 / (1.0 + tx * tx); // 1/[1+tan^2(x/2)]
-
-    *cx = (1.0 - tx * tx) * den;              // cos(x)
-    *sx = 2.0 * tx * den;                     // sin(x)
-
-    /* multiply by eccentricity ? */
-    if ( ecc >= 0.0 )
-    {
-        *cx *= ecc;                           // ecc*cos(x)
-        *sx *= ecc;                           // ecc*sin(x)
-    } // end if
+    tm_sincos_d( sx, cx, x, ecc );
 
     return;
 } // end coo_sincos
@@ -107,120 +77,81 @@ inline void coo_sincos(
 /******************************************************************************/
 
 /*******************************************************************************
- *  FUNCTION    : itercore
- *  DESCRIPTION : apply single pass of iteration method of Danby-Burkardt (1983)
- *                with quintic convergence to Kepler's Equation
- *  INPUT       : - value "ecc" for eccentricity 0 <= ecc < 1
- *                - value "ma" for mean anomaly 0 <= ma < pi in radians
- *                - value "x" in radians as initial guess for E0
- *  OUTPUT      : iterated value x(n+1) = E0 + delta(5)
- ******************************************************************************/
-static double itercore(
-    const double ecc,
-    const double ma,
-    const double x
-    )
-{
-    double ecosx, esinx, dx;
-
-    /* calculate sin, cos */
-    coo_sincos( &esinx, &ecosx, x, ecc );
-
-    /* evaluate Kepler Equation */
-    const double f0 = ma - x + esinx;
-
-    /* evaluate (scaled) derivatives of Kepler Equation */
-    const double f1 = 1.0 - ecosx + addzero; /* to avoid NaN at (x,e) = (0,1) */
-    const double f2 = esinx / 2.0;
-    const double f3 = ecosx / 6.0;
-    const double f4 = -esinx / 24.0;
-
-    /* Iteration method: Newton-Raphson, quadratic convergence */
-    dx = f0 / f1;
-
-    /* Iteration method: Halley, cubic convergence */
-    dx = f0 / (f1 + f2 * dx);
-
-    /* Iteration method: Danby-Burkardt, quartic convergence */
-    dx = f0 / (f1 + f2 * dx + f3 * dx * dx);
-
-    /* Iteration method: Danby-Burkardt, quintic convergence */
-    dx = f0 / (f1 + f2 * dx + f3 * dx * dx + f4 * dx * dx * dx);
-
-    return( x + dx );
-} // end itercore
-
-/******************************************************************************/
-
-/*******************************************************************************
- *  FUNCTION    : markley
- *  DESCRIPTION : quasi-direct solution method of Markley (1995) for Kepler Eq.
+ *  FUNCTION    : coo_kesolver
+ *  DESCRIPTION : simplified version of solver function from
+ *                Kepler Equation Solver Library
  *  INPUT       : - value "ecc" for eccentricity 0 <= ecc < 1
- *                - value "ma" for mean anomaly 0 <= ma < pi in radians
- *  OUTPUT      : solution E(e,M) for eccentric anomaly
+ *                - value "ma" for mean anomaly in radians,
+ *                  any arbitrary real number is OK
+ *  OUTPUT      : solution E(e,M) for eccentric anomaly in range 0 <= E < 2*pi
+ *  NOTE        : quasi-direct method of Markley (1995) with a 5th order
+ *                correction after Danby & Burkardt (1983), see tm_kesolver()
+ *                in cvt_tmpl.h
  *  REFERENCE   : Markley (1995), Celest. Mech. Dyn. Astron. 63, p.101-111
  ******************************************************************************/
-static double markley(
+COO_DISPATCH double coo_kesolver(
     const double ecc,
     const double ma
     )
 {
-    //double x, a, ad, ak, d, q, r, w;
-
-    /* calculate parameters */
-    const double tmp = 1.0 / (M_PISQ - 6.0);
-    const double ad  = 3.0 * M_PISQ * tmp;
-    const double ak  = 1.6 * M_PI * tmp;
-    const double a   = ad + ak * (M_PI - ma) / (1.0 + ecc);                 // eq.(20)
-    const double d   = 3.0 * (1.0 - ecc) + a * ecc;                         // eq.(5)
-    const double q   = 2.0 * a * d * (1.0 - ecc) - ma * ma;                 // eq.(9)
-    const double r   = 3.0 * a * d * (d - 1.0 + ecc) * ma + ma * ma * ma;   // eq.(10)
-    double       w   = cbrt( fabs(r) + sqrt(q * q * q + r * r) );           // eq.(14)
-    w               *= w;
-
-    /*** STEP #1: find starter from Pade approximation ***/
-    double x0 = 0.0;
-    if ( w > 0.0 )
-    {
-        /* starter E0 */
-        x0 = (2.0 * r * w / (w * w + q * w + q * q) + ma) / d;              // eq.(15)
-    } // end if
-
-    /*** STEP #2: 5th order correction for starter after Danby & Burkardt (1983) ***/
-    return(
-        itercore(ecc, ma, x0)                                               // eq.(24)
-    );
-} // end markley
+    return( tm_kesolver_d( ecc, ma ) );
+} // end coo_kesolver
 
 /******************************************************************************/
 
 /*******************************************************************************
- *  FUNCTION    : coo_kesolver
- *  DESCRIPTION : simplified version of solver function from
- *                Kepler Equation Solver Library
+ *  FUNCTION    : coo_kesolver_ws
+ *  DESCRIPTION : solver for Kepler Equation with warm start from a given
+ *                initial guess, e.g. the solution for a nearby mean anomaly;
+ *                falls back to coo_kesolver() if the iteration does not
+ *                converge within a few passes
  *  INPUT       : - value "ecc" for eccentricity 0 <= ecc < 1
  *                - value "ma" for mean anomaly in radians,
  *                  any arbitrary real number is OK
+ *                - value "ea0" for initial guess of E in radians,
+ *                  on the same revolution as "ma"
  *  OUTPUT      : solution E(e,M) for eccentric anomaly in range 0 <= E < 2*pi
  ******************************************************************************/
-double coo_kesolver(
+double coo_kesolver_ws(
     const double ecc,
-    const double ma
+    const double ma,
+    const double ea0
     )
 {
     /* reduce mean anomaly to -pi <= M < pi */
-    const double mr = reduce(ma);
+    const double mr = tm_reduce_d(ma);
 
-    /* solve Kepler Equation for negative values of M */
-    if ( mr < 0.0 )
-    {
-        return( -markley(ecc, -mr) + M_2PI );
-    } // end if
-    /* solve Kepler Equation for positive values of M */
-    else
+    /* move guess to the same revolution as reduced M, and clamp it to the
+     * bracket M <= E <= M + e (M >= 0) or M - e <= E <= M (M < 0)
+     */
+    double x = mr + remainder(ea0 - mr, M_2PI);
+    if ( mr >= 0.0 ) x = fmin( fmax( x, mr ), mr + ecc );
+    else             x = fmin( fmax( x, mr - ecc ), mr );
+
+    /* quintic iteration passes from initial guess */
+    for (register int k = 0; k < 3; k++)
     {
-        return( markley(ecc, mr) );
-    } // end else
-} // end coo_kesolver
+        const double xn = tm_itercore_d(ecc, mr, x);
+        const double dx = fabs(xn - x);
+        x = xn;
+
+        /* converged to machine precision ? */
+        if ( dx <= 4.0 * DBL_EPSILON * (1.0 + fabs(x)) )
+        {
+            return( (x < 0.0) ? x + M_2PI : x );
+        } // end if
+    } // end for
+
+#if COO_KEPLER_DEBUG
+    fprintf(
+        stderr,
+        "%s: Warning = no convergence for e = %g, M = %g, E0 = %g\n",
+        __func__, ecc, ma, ea0
+    );
+#endif
+
+    /* bad initial guess, use starter */
+    return( coo_kesolver(ecc, ma) );
+} // end coo_kesolver_ws
 
 /******************************************************************************/
@@ -49,6 +49,23 @@ double coo_kesolver(
 );
 
 
+/*!
+ * @brief solver for Kepler Equation with warm start
+ * @details iterates from the initial guess \a ea0, e.g. the solution for a
+ * nearby mean anomaly; falls back to coo_kesolver() if the guess is too poor
+ * @param[in] ecc eccentricity, 0 < ecc < 1
+ * @param[in] ma mean anomaly in radians
+ * @param[in] ea0 initial guess for eccentric anomaly in radians, on the same
+ * revolution as \a ma
+ * @return eccentric anomaly in radians, 0 <= E < 2 pi
+ */
+double coo_kesolver_ws(
+    const double ecc,
+    const double ma,
+    const double ea0
+);
+
+
 /*!
  * @brief evaluate sin(x), cos(x) simultaneously
  * @details modify return value based on parameter "ecc":
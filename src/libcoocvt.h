@@ -32,11 +32,60 @@
 /*** include prerequisite standard headers ***/
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 
 /******************************************************************************/
 
+/*** define pre-processor macros ***/
+
+/*!
+ * @brief C99 restrict qualifier, also usable from C++
+ */
+#ifdef __cplusplus
+    #define COO_RESTRICT __restrict__
+#else
+    #define COO_RESTRICT restrict
+#endif
+
+
+/*!
+ * @brief number of 64-bit words for a per-object status bitmap
+ * @details bit (i % 64) of word (i / 64) is set if object i failed to convert,
+ * see coocvt_mask()
+ */
+#define COO_MASK_WORDS(dim)   (((dim) + 63u) / 64u)
+
+
+/*!
+ * @brief test status bit of object \a i in bitmap \a mask
+ */
+#define COO_MASK_TEST(mask,i) (((mask)[(i) >> 6] >> ((i) & 63u)) & 1u)
+
+
+/*!
+ * @brief allocation flags for coo_alloc_bodies() and coo_alloc_soa()
+ * @details may be combined with bitwise or; huge pages are a hint and
+ * silently fall back to normal pages if not available
+ */
+#define COO_ALLOC_DEFAULT   0u  ///< 64-byte aligned, zero-initialised
+#define COO_ALLOC_HUGE      1u  ///< transparent huge pages (madvise)
+#define COO_ALLOC_HUGETLB   2u  ///< explicit huge pages (MAP_HUGETLB)
+#define COO_ALLOC_PREFAULT  4u  ///< touch all pages with the context's threads
+
+
+/*!
+ * @brief column of #view_t for member \a member of an array of structs of
+ * type \a type starting at \a base
+ * @details e.g. COO_COL(part, particle_t, pos[0]) for the x components of
+ * a caller-owned array "part"; the member must be of type double
+ */
+#define COO_COL(base,type,member) \
+    ((col_t){ (double*)((char*)(base) + offsetof(type, member)), sizeof(type) })
+
+/******************************************************************************/
+
 /*** declare data structures ***/
 
 /*!
@@ -53,6 +102,20 @@ typedef struct
 } vec3d_t;
 
 
+/*!
+ * @brief type definition for a 3-dimensional vector in single precision
+ * @details using \a abs for padding to size of 4x float,
+ * also using \a abs to store absolute value of vector
+ */
+typedef struct
+{
+    float x;    ///< x component
+    float y;    ///< y component
+    float z;    ///< z component
+    float abs;  ///< absolute value as Euclidean norm
+} vec3f_t;
+
+
 /*!
  * @brief type definition for a 4-dimensional vector
  * @details used for regularized parametric coordinates in Kustaanheimo-Stiefel
@@ -129,6 +192,33 @@ typedef struct
 } hel_t;
 
 
+/*!
+ * @brief Heliocentric Cartesian Coordinates in single precision
+ * @details same layout as #hco_t with components of type #vec3f_t,
+ * for screening and visualization of large object sets
+ */
+typedef struct
+{
+    vec3f_t pos; ///< position
+    vec3f_t vel; ///< velocity
+} hcof_t;
+
+
+/*!
+ * @brief Heliocentric Keplerian orbital elements in single precision
+ * @details same layout as #hel_t, only for elliptic motion (0 < ecc < 1)
+ */
+typedef struct
+{
+    float sma; ///< semi-major axis
+    float ecc; ///< eccentricity
+    float inc; ///< inclination
+    float aph; ///< argument of perihelion
+    float lan; ///< longitude of ascending node
+    float man; ///< mean anomaly
+} helf_t;
+
+
 /*!
  * @brief type definition for Heliocentric (elliptic) Delaunay elements (DEL)
  * @details canonical action-angle elements
@@ -144,6 +234,130 @@ typedef struct
 } del_t;
 
 
+/*!
+ * @brief matrix of partial derivatives (Jacobian) for a single object
+ * @details 6x6 matrix with m[row][col] = d(out[row]) / d(in[col]), using
+ * the order (x, y, z, vx, vy, vz) for Cartesian coordinates and the order
+ * (sma, ecc, inc, aph, lan, man) of #hel_t for Keplerian elements
+ */
+typedef struct
+{
+    double m[6][6]; ///< matrix elements, row-major
+} jac_t;
+
+
+/*!
+ * @brief persistent accumulator for barycenter (center of mass) sums
+ * @details compensated running sums of total mass and mass-weighted position
+ * and velocity, allowing O(1) updates when single objects change
+ */
+typedef struct
+{
+    double   sum[7]; ///< sums of m, m*x, m*y, m*z, m*vx, m*vy, m*vz
+    double   err[7]; ///< compensation terms for \a sum
+    uint32_t count;  ///< number of objects in accumulator
+} bcacc_t;
+
+
+/*!
+ * @brief runtime counters for one coordinate conversion mode
+ * @details only collected if the library is built with -DCOO_STATS=1,
+ * see coo_stats_get()
+ */
+typedef struct
+{
+    uint64_t calls;  ///< number of conversion calls
+    uint64_t bodies; ///< number of bodies processed
+    uint64_t fails;  ///< number of bodies that failed to convert (e.g. e >= 1)
+    uint64_t ticks;  ///< cumulative CPU time stamp counter ticks
+} stats_t;
+
+
+/*!
+ * @brief cached orientation matrix of an orbit
+ * @details first two columns P, Q of the rotation from the orbital plane to
+ * the reference frame, keyed on the angles they were computed for; see
+ * coo_orient_init() and hel2hco_cached()
+ */
+typedef struct
+{
+    double inc;  ///< inclination of cache key
+    double aph;  ///< argument of pericenter of cache key
+    double lan;  ///< longitude of ascending node of cache key
+    double p[3]; ///< unit vector towards pericenter
+    double q[3]; ///< unit vector in orbital plane, 90 deg ahead of \a p
+} orient_t;
+
+
+/*!
+ * @brief opaque conversion context, see coo_ctx_create()
+ * @details owns settings (threads, gravitational constant), scratch buffers
+ * and statistics of one independent simulation
+ */
+typedef struct coo_ctx coo_ctx_t;
+
+
+/*!
+ * @brief structure-of-arrays storage for heliocentric coordinates, elements
+ * and masses of many objects
+ * @details all arrays are 64-byte aligned and hold \a dim entries, see
+ * coo_alloc_soa()
+ */
+typedef struct
+{
+    uint32_t dim;  ///< number of objects
+    double*  x;    ///< heliocentric position, x component
+    double*  y;    ///< heliocentric position, y component
+    double*  z;    ///< heliocentric position, z component
+    double*  vx;   ///< heliocentric velocity, x component
+    double*  vy;   ///< heliocentric velocity, y component
+    double*  vz;   ///< heliocentric velocity, z component
+    double*  sma;  ///< semi-major axis
+    double*  ecc;  ///< eccentricity
+    double*  inc;  ///< inclination
+    double*  aph;  ///< argument of perihelion
+    double*  lan;  ///< longitude of ascending node
+    double*  man;  ///< mean anomaly
+    double*  mass; ///< mass in units of solar mass
+} body_soa_t;
+
+
+/*!
+ * @brief strided column of doubles in caller-owned memory
+ * @details entry i is at byte address ptr + i * stride, see #COO_COL
+ */
+typedef struct
+{
+    double* ptr;    ///< address of entry 0
+    size_t  stride; ///< distance of consecutive entries in bytes
+} col_t;
+
+
+/*!
+ * @brief view of caller-owned object data for in-place conversions
+ * @details one column per coordinate, element and mass, so that the
+ * conversion kernels read and write any array-of-structs or
+ * structure-of-arrays layout directly, see coocvt_view()
+ */
+typedef struct
+{
+    uint32_t dim;  ///< number of objects
+    col_t    x;    ///< heliocentric position, x component
+    col_t    y;    ///< heliocentric position, y component
+    col_t    z;    ///< heliocentric position, z component
+    col_t    vx;   ///< heliocentric velocity, x component
+    col_t    vy;   ///< heliocentric velocity, y component
+    col_t    vz;   ///< heliocentric velocity, z component
+    col_t    sma;  ///< semi-major axis
+    col_t    ecc;  ///< eccentricity
+    col_t    inc;  ///< inclination
+    col_t    aph;  ///< argument of perihelion
+    col_t    lan;  ///< longitude of ascending node
+    col_t    man;  ///< mean anomaly
+    col_t    mass; ///< mass in units of solar mass
+} view_t;
+
+
 /*!
  * @brief collection of coordinates for a single object
  * @details using \a hel as generic elements for any kind of Cartesian coord.
@@ -201,6 +415,9 @@ typedef enum
     CVT_HCO2HEL, // heliocentric coord. to heliocentric elem.
     CVT_HEL2HCO, // heliocentric elem.  to heliocentric coord.
 
+    /* special conversion modes */
+    CVT_HEL2HCO_POS, // heliocentric elem. to heliocentric positions only
+
     /* total number of available modes */
     CVT_TOTAL_NUMBER
 } CVT_MODE_e;
@@ -217,7 +434,12 @@ extern "C" {
 
 /*!
  * @brief main coordinate conversion function
- * @details convert in-place in array \a obj using conversion \a mode
+ * @details convert in-place in array \a obj using conversion \a mode.
+ * The conversions between heliocentric coordinates and elements use inline
+ * approximations instead of the libm functions: atan2() and hypot() in
+ * #CVT_HCO2HEL (errors below 1.70 and 1.25 ulp), cbrt() in the starting
+ * value of Kepler's Equation (below 0.74 ulp); results may thus differ from
+ * libm in the last bits. Build with COO_STRICT_MATH defined to use libm.
  * @param[in,out] obj pointer to array of coordinate structures of type #body_t
  * @param[in] dim dimension of array \a obj
  * @param[in] center index of central body
@@ -231,6 +453,469 @@ int coocvt(
     CVT_MODE_e     mode
 );
 
+
+/*!
+ * @brief coordinate conversion with per-object status
+ * @details convert in-place in array \a obj using conversion \a mode, and
+ * report objects that failed to convert (e.g. unbound orbits) in the same
+ * pass; failed objects keep their previous output values
+ * @param[in,out] obj pointer to array of coordinate structures of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object, see #COO_MASK_TEST (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_mask(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    CVT_MODE_e     mode,
+    uint64_t       mask[],
+    uint32_t*      nfail
+);
+
+
+/*!
+ * @brief coordinate conversion from a source array into a separate
+ * destination array
+ * @details \a src is only read; of \a dst only the output member of
+ * \a mode is written (e.g. dst[].hel for #CVT_HCO2HEL), so several targets
+ * can be produced from one snapshot without copying it first
+ * @param[in,out] ctx conversion context, settings and counters (may be
+ * NULL for default settings)
+ * @param[out] dst array of type #body_t for output
+ * @param[in] src array of type #body_t for input, must not overlap \a dst
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_oop(
+    coo_ctx_t*                 ctx,
+    body_t* COO_RESTRICT       dst,
+    const body_t* COO_RESTRICT src,
+    const uint32_t             dim,
+    const uint32_t             center,
+    CVT_MODE_e                 mode,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief re-run the conversion of selected objects in extended precision
+ * @details converts only objects whose bit in \a mask is set, with all
+ * intermediate results in long double (or __float128 if the library is
+ * built with COO_FLOAT128); input and output stay in #body_t. Typical use
+ * is a fast batch with coocvt_mask(), followed by coo_mask_ecc() to add
+ * near-parabolic orbits to the failed objects, and coocvt_refine() on the
+ * resulting mask. Translations (#CVT_BCO2HCO, #CVT_HCO2BCO) are not re-run.
+ * @param[in] ctx conversion context, settings (may be NULL for default
+ * settings); counters are not updated
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[in,out] mask status bitmap with COO_MASK_WORDS(dim) entries; on
+ * input bit set for each object to convert, on output bit set for each
+ * object that failed again (may be NULL to convert all objects)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_refine(
+    coo_ctx_t*     ctx,
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    CVT_MODE_e     mode,
+    uint64_t       mask[],
+    uint32_t*      nfail
+);
+
+
+/*!
+ * @brief flag objects with eccentricity close to or above 1
+ * @details sets the bits of all objects with obj[].hel.ecc >= \a emin or
+ * NaN and leaves the other bits unchanged, so that it can be applied to the
+ * mask of a conversion, e.g. after hco2hel on the resulting elements or
+ * before hel2hco on the input elements; the flagged objects are then
+ * re-run with coocvt_refine()
+ * @param[in] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (never flagged)
+ * @param[in] emin threshold for eccentricity, e.g. 0.99
+ * @param[in,out] mask status bitmap with COO_MASK_WORDS(dim) entries
+ * @param[out] nflag number of newly flagged objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int coo_mask_ecc(
+    const body_t   obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    const double   emin,
+    uint64_t       mask[],
+    uint32_t*      nflag
+);
+
+
+/*!
+ * @brief coordinate conversion for a contiguous range of objects
+ * @details converts objects first ... first + count - 1 (at most up to
+ * \a dim) serially and without locks, so that callers can schedule the
+ * blocks of an array on their own threads, e.g. a C++ execution policy;
+ * ranges starting at distinct multiples of 64 may be converted
+ * concurrently. Only #CVT_HCO2HEL, #CVT_HEL2HCO and #CVT_HEL2HCO_POS are
+ * available, since translations need sums over all objects.
+ * @param[in] ctx conversion context, settings (may be NULL for default
+ * settings); the number of threads is ignored, counters are not updated
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[in] first index of first object, multiple of 64
+ * @param[in] count number of objects, multiple of 64 unless the range
+ * reaches the end of the array (\a first + \a count >= \a dim), so that
+ * concurrent ranges never share a word of \a mask
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, only the
+ * words of the range are written (may be NULL)
+ * @param[out] nfail number of failed objects in the range (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_range(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    CVT_MODE_e       mode,
+    const uint32_t   first,
+    const uint32_t   count,
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+/*!
+ * @brief coordinate conversion with partial derivatives
+ * @details convert in-place in array \a obj using conversion \a mode, and
+ * store the Jacobian d(output) / d(input) for each object in array \a jac;
+ * only available for modes #CVT_HCO2HEL and #CVT_HEL2HCO, for objects with
+ * invalid elements or nearly circular or planar orbits it is set to zero,
+ * see coocvt_jac_ctx()
+ * @param[in,out] obj pointer to array of coordinate structures of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[out] jac pointer to array of type #jac_t with \a dim entries
+ * @return 0 for success, 1 for error
+ */
+int coocvt_jac(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    CVT_MODE_e     mode,
+    jac_t          jac[]
+);
+
+
+/*!
+ * @brief coordinate conversion with partial derivatives, using the
+ * settings of a conversion context, and report objects without valid
+ * partials
+ * @details as coocvt_jac(), with the gravitational constant and the number
+ * of threads taken from \a ctx; the bit in \a mask is set for each object
+ * whose Jacobian is set to zero. For #CVT_HCO2HEL these are objects that
+ * fail to convert, nearly circular or planar orbits (e or sin(inc) below
+ * sqrt(DBL_EPSILON), where aph and lan are ill-defined); for #CVT_HEL2HCO
+ * objects with invalid elements, which keep their previous coordinates.
+ * @param[in] ctx conversion context, settings (may be NULL for default
+ * settings); counters are not updated
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[out] jac array of type #jac_t with \a dim entries
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each object without valid partials (may be NULL)
+ * @param[out] nfail number of objects without valid partials (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_jac_ctx(
+    const coo_ctx_t* ctx,
+    body_t           obj[],
+    const uint32_t   dim,
+    const uint32_t   center,
+    CVT_MODE_e       mode,
+    jac_t            jac[],
+    uint64_t         mask[],
+    uint32_t*        nfail
+);
+
+/*** compact array conversion functions ***/
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements
+ * for compact arrays
+ * @details identical to hco2hel_ctx(), but with separate arrays for input
+ * coordinates, output elements and masses instead of #body_t
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[out] ele array of type #hel_t for elements
+ * @param[in] coo array of type #hco_t for coordinates
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_arr(
+    const coo_ctx_t*           ctx,
+    hel_t* COO_RESTRICT        ele,
+    const hco_t* COO_RESTRICT  coo,
+    const double* COO_RESTRICT mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * for compact arrays
+ * @details identical to hel2hco_ctx(), but with separate arrays for input
+ * elements, output coordinates and masses instead of #body_t
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[out] coo array of type #hco_t for coordinates
+ * @param[in] ele array of type #hel_t for elements
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_arr(
+    const coo_ctx_t*           ctx,
+    hco_t* COO_RESTRICT        coo,
+    const hel_t* COO_RESTRICT  ele,
+    const double* COO_RESTRICT mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric positions only
+ * for compact arrays
+ * @details identical to hel2hco_pos_ctx(), but with separate arrays for
+ * input elements, output positions and masses instead of #body_t
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[out] coo array of type #hco_t for positions (coo[].vel unused)
+ * @param[in] ele array of type #hel_t for elements
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_pos_arr(
+    const coo_ctx_t*           ctx,
+    hco_t* COO_RESTRICT        coo,
+    const hel_t* COO_RESTRICT  ele,
+    const double* COO_RESTRICT mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+/*** single- and mixed-precision conversion functions ***/
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements
+ * in single precision for compact arrays
+ * @details same as hco2hel_arr() for arrays of #hcof_t, #helf_t and
+ * float masses; all arithmetic in single precision
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[out] ele array of type #helf_t for elements
+ * @param[in] coo array of type #hcof_t for coordinates
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int hco2hel_arr_f(
+    const coo_ctx_t*           ctx,
+    helf_t* COO_RESTRICT       ele,
+    const hcof_t* COO_RESTRICT coo,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * in single precision for compact arrays
+ * @details same as hel2hco_arr() for arrays of #hcof_t, #helf_t and
+ * float masses; all arithmetic in single precision
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[out] coo array of type #hcof_t for coordinates
+ * @param[in] ele array of type #helf_t for elements
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_arr_f(
+    const coo_ctx_t*           ctx,
+    hcof_t* COO_RESTRICT       coo,
+    const helf_t* COO_RESTRICT ele,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric positions only
+ * in single precision for compact arrays
+ * @details same as hel2hco_arr_f(), but members coo[].vel are not written
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[out] coo array of type #hcof_t for positions (coo[].vel unused)
+ * @param[in] ele array of type #helf_t for elements
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_pos_arr_f(
+    const coo_ctx_t*           ctx,
+    hcof_t* COO_RESTRICT       coo,
+    const helf_t* COO_RESTRICT ele,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates
+ * in mixed precision for compact arrays
+ * @details like hel2hco_arr_f(), with single-precision storage and
+ * orientation, but Kepler's Equation is solved in double precision;
+ * the eccentric anomaly stays accurate for highly eccentric orbits, where
+ * the single-precision solver loses most of its digits
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[out] coo array of type #hcof_t for coordinates
+ * @param[in] ele array of type #helf_t for elements
+ * @param[in] mass array of masses
+ * @param[in] dim dimension of arrays
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_arr_mf(
+    const coo_ctx_t*           ctx,
+    hcof_t* COO_RESTRICT       coo,
+    const helf_t* COO_RESTRICT ele,
+    const float* COO_RESTRICT  mass,
+    const uint32_t             dim,
+    const uint32_t             center,
+    uint64_t                   mask[],
+    uint32_t*                  nfail
+);
+
+/*** ephemeris functions ***/
+
+/*!
+ * @brief invalidate all entries of an orientation matrix cache
+ * @param[out] cache array of type #orient_t
+ * @param[in] dim dimension of array \a cache
+ * @return none
+ */
+void coo_orient_init(
+    orient_t       cache[],
+    const uint32_t dim
+);
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates using
+ * cached orientation matrices
+ * @details for objects whose angles inc, aph, lan are unchanged since the
+ * previous call, the six trigonometric evaluations are skipped; results are
+ * identical to hel2hco() and to coocvt_mask() with #CVT_HEL2HCO; the loop is
+ * serial, with the default gravitational constant (no conversion context)
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body (for mass parameter GM)
+ * @param[in,out] cache array of type #orient_t with \a dim entries,
+ * initialised with coo_orient_init()
+ * @param[out] mask status bitmap with COO_MASK_WORDS(dim) entries, bit set
+ * for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_cached(
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    orient_t       cache[],
+    uint64_t       mask[],
+    uint32_t*      nfail
+);
+
+
+/*!
+ * @brief convert elements of a single object to heliocentric coordinates
+ * at several epochs
+ * @details the orientation matrix is computed once and each Kepler Equation
+ * is warm-started from the previous epoch, fastest for ordered times; the
+ * mean anomaly at time t[k] is ele->man + mm * t[k]
+ * @param[out] coo array of type #hco_t with \a num entries
+ * @param[in] ele elements of type #hel_t, valid at t = 0
+ * @param[in] mm mean motion n = (mu / a^3)^1/2 in radians per day
+ * @param[in] t array of times in days relative to the epoch of \a ele
+ * @param[in] num number of epochs
+ * @return 0 for success, 1 for error
+ */
+int hel2hco_epochs(
+    hco_t              coo[],
+    const hel_t* const ele,
+    const double       mm,
+    const double       t[],
+    const uint32_t     num
+);
+
 /*** input / output functions ***/
 
 /*!
@@ -413,6 +1098,491 @@ double coo_total_mass(
     const uint32_t uptoIdx
 );
 
+/*** barycenter accumulator functions ***/
+
+/*!
+ * @brief reset barycenter accumulator to an empty system
+ * @param[out] acc pointer to accumulator of type #bcacc_t
+ * @return none
+ */
+void coo_bcacc_init(bcacc_t* acc);
+
+
+/*!
+ * @brief fill barycenter accumulator from array of objects
+ * @details accumulator holds objects in range [fromIdx : uptoIdx-1]
+ * @param[out] acc pointer to accumulator of type #bcacc_t
+ * @param[in] obj input array of type #body_t
+ * @param[in] fromIdx lowest index in array \a obj
+ * @param[in] uptoIdx highest index in array \a obj
+ * @param[in] type coordinate type from enum #COO_TYPE_e
+ * @return 0 for success, 1 for error
+ */
+int coo_bcacc_fill(
+    bcacc_t*         acc,
+    const body_t     obj[],
+    const uint32_t   fromIdx,
+    const uint32_t   uptoIdx,
+    const COO_TYPE_e type
+);
+
+
+/*!
+ * @brief add a single object to barycenter accumulator
+ * @param[in,out] acc pointer to accumulator of type #bcacc_t
+ * @param[in] coo coordinates of object
+ * @param[in] mass mass of object
+ * @return none
+ */
+void coo_bcacc_add(
+    bcacc_t*           acc,
+    const hco_t* const coo,
+    const double       mass
+);
+
+
+/*!
+ * @brief remove a single object from barycenter accumulator
+ * @param[in,out] acc pointer to accumulator of type #bcacc_t
+ * @param[in] coo coordinates of object, as previously added
+ * @param[in] mass mass of object, as previously added
+ * @return none
+ */
+void coo_bcacc_remove(
+    bcacc_t*           acc,
+    const hco_t* const coo,
+    const double       mass
+);
+
+
+/*!
+ * @brief replace coordinates of a single object in barycenter accumulator
+ * @param[in,out] acc pointer to accumulator of type #bcacc_t
+ * @param[in] old previous coordinates of object
+ * @param[in] coo new coordinates of object
+ * @param[in] mass (unchanged) mass of object
+ * @return none
+ */
+void coo_bcacc_update(
+    bcacc_t*           acc,
+    const hco_t* const old,
+    const hco_t* const coo,
+    const double       mass
+);
+
+
+/*!
+ * @brief return barycenter position & velocity from accumulator
+ * @param[out] bc coordinates for center of mass (barycenter)
+ * @param[in] acc pointer to accumulator of type #bcacc_t
+ * @return 0 for success, 1 for error (empty system or total mass <= 0)
+ */
+int coo_bcacc_get(
+    hco_t*               bc,
+    const bcacc_t* const acc
+);
+
+
+/*!
+ * @brief convert heliocentric coordinates to barycentric coordinates
+ * using a barycenter accumulator
+ * @details the accumulator must hold the heliocentric coordinates of all
+ * objects, see coo_bcacc_fill(); only the recentering pass is performed
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] acc barycenter accumulator of type #bcacc_t
+ * @return 0 for success, 1 for error
+ */
+int hco2bco_acc(
+    body_t               obj[],
+    const uint32_t       dim,
+    const bcacc_t* const acc
+);
+
+/*** runtime statistics functions ***/
+
+/*!
+ * @brief read runtime counters of a conversion mode
+ * @details counters are collected by coocvt() and coocvt_mask() only if the
+ * library is built with -DCOO_STATS=1
+ * @param[out] stats counters of type #stats_t, zero if disabled
+ * @param[in] mode conversion mode from enum #CVT_MODE_e
+ * @return 0 for success, 1 for error (invalid mode or counters disabled)
+ */
+int coo_stats_get(
+    stats_t*         stats,
+    const CVT_MODE_e mode
+);
+
+
+/*!
+ * @brief reset runtime counters of all conversion modes to zero
+ * @return none
+ */
+void coo_stats_reset(void);
+
+/*** tracing functions ***/
+
+/*!
+ * @brief start recording trace events
+ * @details while active, coo_read_*(), coocvt(), coocvt_mask() and
+ * coo_show_*() record begin and end events with thread IDs; events are kept in
+ * memory and written by coo_trace_stop(), events beyond \a capacity are
+ * dropped and counted
+ * @param[in] path name of output file for JSON trace
+ * @param[in] capacity maximum number of events
+ * @return 0 for success, 1 for error (already active or out of memory)
+ */
+int coo_trace_start(
+    const char*    path,
+    const uint32_t capacity
+);
+
+
+/*!
+ * @brief stop recording and write trace events to JSON file
+ * @details writes Chrome trace-event JSON for chrome://tracing or Perfetto;
+ * must be called outside of OpenMP parallel regions, events recorded
+ * concurrently by other threads are waited for or dropped
+ * @return 0 for success, 1 for error (not active, called in a parallel
+ * region or file error)
+ */
+int coo_trace_stop(void);
+
+
+/*!
+ * @brief mark begin of a user-defined phase in the trace
+ * @param[in] name name of phase, must be a string literal or outlive the tracer
+ * @return none
+ */
+void coo_trace_begin(const char* name);
+
+
+/*!
+ * @brief mark end of a user-defined phase in the trace
+ * @param[in] name name of phase, same as for coo_trace_begin()
+ * @return none
+ */
+void coo_trace_end(const char* name);
+
+/*** memory allocation functions ***/
+
+/*!
+ * @brief allocate zero-initialised storage for a compact array
+ * @details for arrays of a single representation, e.g. #hco_t, #hel_t or
+ * double masses, see hco2hel_arr() and hel2hco_arr(); alignment, huge pages
+ * and prefaulting as for coo_alloc_bodies()
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[in] dim number of entries (> 0)
+ * @param[in] size size of one entry in bytes
+ * @param[in] flags combination of COO_ALLOC_* flags
+ * @return pointer to array, NULL if out of memory; release with
+ * coo_free_array()
+ */
+void* coo_alloc_array(
+    const coo_ctx_t* ctx,
+    const uint32_t   dim,
+    const size_t     size,
+    const uint32_t   flags
+);
+
+
+/*!
+ * @brief release storage allocated with coo_alloc_array()
+ * @param[in] arr pointer to array (may be NULL)
+ * @return none
+ */
+void coo_free_array(void* arr);
+
+
+/*!
+ * @brief allocate zero-initialised storage for an array of objects
+ * @details the array is 64-byte aligned; with #COO_ALLOC_PREFAULT all pages
+ * are touched by the threads of \a ctx in blocks of 64 objects with the
+ * same static partition as the conversion kernels, so that first-touch
+ * placement matches the threads that later convert the data
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[in] dim number of objects (> 0)
+ * @param[in] flags combination of COO_ALLOC_* flags
+ * @return pointer to array of type #body_t, NULL if out of memory;
+ * release with coo_free_bodies()
+ */
+body_t* coo_alloc_bodies(
+    const coo_ctx_t* ctx,
+    const uint32_t   dim,
+    const uint32_t   flags
+);
+
+
+/*!
+ * @brief release storage allocated with coo_alloc_bodies()
+ * @param[in] obj pointer to array of type #body_t (may be NULL)
+ * @return none
+ */
+void coo_free_bodies(body_t* obj);
+
+
+/*!
+ * @brief allocate zero-initialised structure-of-arrays storage
+ * @details all arrays of \a soa share one block and are 64-byte aligned;
+ * see coo_alloc_bodies() for \a ctx and \a flags
+ * @param[out] soa structure of type #body_soa_t to set up
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[in] dim number of objects (> 0)
+ * @param[in] flags combination of COO_ALLOC_* flags
+ * @return 0 for success, 1 for error; release with coo_free_soa()
+ */
+int coo_alloc_soa(
+    body_soa_t*      soa,
+    const coo_ctx_t* ctx,
+    const uint32_t   dim,
+    const uint32_t   flags
+);
+
+
+/*!
+ * @brief release storage allocated with coo_alloc_soa()
+ * @details all pointers of \a soa are reset to NULL
+ * @param[in,out] soa structure of type #body_soa_t (may be NULL)
+ * @return none
+ */
+void coo_free_soa(body_soa_t* soa);
+
+/*** view functions ***/
+
+/*!
+ * @brief set up a view of an array of type #body_t
+ * @details the view uses the members hco, hel and mass of \a obj
+ * @param[out] view view of type #view_t
+ * @param[in] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @return 0 for success, 1 for error
+ */
+int coo_view_bodies(
+    view_t*        view,
+    body_t         obj[],
+    const uint32_t dim
+);
+
+
+/*!
+ * @brief set up a view of structure-of-arrays storage
+ * @param[out] view view of type #view_t
+ * @param[in] soa storage of type #body_soa_t, see coo_alloc_soa()
+ * @return 0 for success, 1 for error
+ */
+int coo_view_soa(
+    view_t*                 view,
+    const body_soa_t* const soa
+);
+
+
+/*!
+ * @brief coordinate conversion in caller-owned memory
+ * @details convert directly in the columns of \a view using conversion
+ * \a mode, without copying to or from #body_t; failed objects keep their
+ * previous output values; only the modes #CVT_HCO2HEL, #CVT_HEL2HCO and
+ * #CVT_HEL2HCO_POS are available
+ * @param[in,out] ctx conversion context, settings and counters (may be
+ * NULL for default settings)
+ * @param[in] view view of type #view_t to caller-owned data
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[out] mask status bitmap with COO_MASK_WORDS(view->dim) entries, bit
+ * set for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_view(
+    coo_ctx_t*          ctx,
+    const view_t* const view,
+    const uint32_t      center,
+    CVT_MODE_e          mode,
+    uint64_t            mask[],
+    uint32_t*           nfail
+);
+
+
+/*!
+ * @brief coordinate conversion between caller-owned buffers
+ * @details like coocvt_view(), but reads the input and mass columns of
+ * \a src and writes the output columns of \a dst, so that one snapshot can
+ * be converted to several targets, or converted while other threads read
+ * the old state
+ * @param[in,out] ctx conversion context, settings and counters (may be
+ * NULL for default settings)
+ * @param[in] dst view of type #view_t for output
+ * @param[in] src view of type #view_t for input, with the same number of
+ * objects as \a dst
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[out] mask status bitmap with COO_MASK_WORDS(src->dim) entries, bit
+ * set for each failed object (may be NULL)
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_view_oop(
+    coo_ctx_t*          ctx,
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      center,
+    CVT_MODE_e          mode,
+    uint64_t            mask[],
+    uint32_t*           nfail
+);
+
+/*** context functions ***/
+
+/*!
+ * @brief create a conversion context with default settings
+ * @details G = gaussk2, OpenMP default number of threads, empty status
+ * bitmap and counters; a context must not be used by several threads at
+ * the same time, but independent contexts can be used concurrently
+ * @return new context, NULL if out of memory
+ */
+coo_ctx_t* coo_ctx_create(void);
+
+
+/*!
+ * @brief release a conversion context and all memory owned by it
+ * @param[in] ctx conversion context (may be NULL)
+ * @return none
+ */
+void coo_ctx_destroy(coo_ctx_t* ctx);
+
+
+/*!
+ * @brief set number of threads for the parallel loops of a context
+ * @param[in,out] ctx conversion context
+ * @param[in] threads number of threads, 0 = OpenMP default
+ * @return 0 for success, 1 for error
+ */
+int coo_ctx_set_threads(
+    coo_ctx_t* ctx,
+    const int  threads
+);
+
+
+/*!
+ * @brief set gravitational constant of a context
+ * @details the mass parameter of each object is G(M+m), with masses in
+ * the units of the simulation
+ * @param[in,out] ctx conversion context
+ * @param[in] gm gravitational constant G (finite and > 0)
+ * @return 0 for success, 1 for error
+ */
+int coo_ctx_set_gm(
+    coo_ctx_t*   ctx,
+    const double gm
+);
+
+
+/*!
+ * @brief enable or disable NUMA-aware execution of a context
+ * @details with NUMA mode, the threads of the parallel conversion loops are
+ * pinned to the CPUs of the process, grouped by node, so that each node
+ * converts a contiguous range of objects; arrays allocated with
+ * coo_alloc_bodies() and #COO_ALLOC_PREFAULT for the same context are
+ * first-touched with the same partition; every thread, the calling one and
+ * the OpenMP workers, gets its previous affinity back at the end of each
+ * parallel loop
+ * @param[in,out] ctx conversion context
+ * @param[in] enable true to enable, false to disable NUMA mode
+ * @return 0 for success, 1 for error (no topology in /sys, e.g. not Linux)
+ */
+int coo_ctx_set_numa(
+    coo_ctx_t* ctx,
+    const bool enable
+);
+
+
+/*!
+ * @brief number of NUMA nodes used by a context
+ * @param[in] ctx conversion context
+ * @return number of nodes with usable CPUs, 0 if NUMA mode is disabled
+ */
+uint32_t coo_ctx_numa_nodes(const coo_ctx_t* ctx);
+
+
+/*!
+ * @brief status bitmap of the last conversion of a context
+ * @details the bitmap has COO_MASK_WORDS(dim) valid entries, with \a dim of
+ * the last call of coo_ctx_cvt(); it is owned by the context and
+ * overwritten by the next conversion
+ * @param[in] ctx conversion context
+ * @param[out] nfail number of failed objects (may be NULL)
+ * @return status bitmap, NULL if no conversion has been done yet
+ */
+const uint64_t* coo_ctx_mask(
+    const coo_ctx_t* ctx,
+    uint32_t*        nfail
+);
+
+
+/*!
+ * @brief read counters of a context for a conversion mode
+ * @param[in] ctx conversion context
+ * @param[out] stats counters of type #stats_t
+ * @param[in] mode conversion mode from enum #CVT_MODE_e
+ * @return 0 for success, 1 for error
+ */
+int coo_ctx_stats(
+    const coo_ctx_t* ctx,
+    stats_t*         stats,
+    const CVT_MODE_e mode
+);
+
+
+/*!
+ * @brief reset counters of a context for all conversion modes to zero
+ * @param[in,out] ctx conversion context
+ * @return none
+ */
+void coo_ctx_reset_stats(coo_ctx_t* ctx);
+
+
+/*!
+ * @brief perform coordinate conversion with the settings of a context
+ * @details failed objects are recorded in the status bitmap of the
+ * context, see coo_ctx_mask()
+ * @param[in,out] ctx conversion context
+ * @param[in,out] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @param[in] center index of central body
+ * @param[in] mode conversion mode from enum #CVT_MODE_e
+ * @return 0 for success, 1 for error
+ */
+int coo_ctx_cvt(
+    coo_ctx_t*     ctx,
+    body_t         obj[],
+    const uint32_t dim,
+    const uint32_t center,
+    CVT_MODE_e     mode
+);
+
+
+/*!
+ * @brief determine barycenter (center of mass) position & velocity
+ * using the settings of a conversion context
+ * @details identical to coo_get_barycenter(), but with the number of threads
+ * taken from \a ctx; the result does not depend on this number
+ * @param[in] ctx conversion context (may be NULL for default settings)
+ * @param[out] bc coordinates for center of mass (barycenter)
+ * @param[in] obj input array of type #body_t
+ * @param[in] fromIdx lowest index in array \a obj
+ * @param[in] uptoIdx highest index in array \a obj
+ * @param[in] type coordinate type from enum #COO_TYPE_e
+ * @return 0 for success, 1 for error
+ */
+int coo_get_barycenter_ctx(
+    const coo_ctx_t* ctx,
+    hco_t*           bc,
+    const body_t     obj[],
+    const uint32_t   fromIdx,
+    const uint32_t   uptoIdx,
+    const COO_TYPE_e type
+);
+
 /*** version information functions ***/
 
 /*!
@@ -0,0 +1,840 @@
+/***************************************************************************//**
+ * @file    libcoocvt.hpp
+ * @brief   header-only C++17 layer for Coordinate Conversion Library
+ * @details the conversions between heliocentric coordinates and elements
+ *          and the Kepler solver are function templates over the scalar
+ *          type and a unit system, so that the compiler can specialize and
+ *          inline them at every call site; they are instances of cvt_tmpl.h,
+ *          the template of the C kernels, which has to be next to this
+ *          header, and agree with the C kernels to rounding of the
+ *          elementary functions. Everything else is a thin
+ *          wrapper around the C API of libcoocvt.h, which stays the stable
+ *          interface of the library.
+ *          Arrays are passed as std::span with C++20, or as coo::span, a
+ *          minimal replacement with the same interface, with C++17.
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef LIBCOOCVT__HPP
+#define LIBCOOCVT__HPP
+
+#if __cplusplus < 201703L
+    #error "libcoocvt.hpp requires C++17 or later"
+#endif
+
+/******************************************************************************/
+
+/*** include prerequisite headers ***/
+
+/* include standard headers */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if (__cplusplus >= 202002L) && __has_include(<span>)
+    #include <span>
+#endif
+
+/* parallel algorithms, opt-in since GCC's backend needs linking with -ltbb */
+#ifdef COO_EXECUTION
+    #include <algorithm>
+    #include <execution>
+    #include <numeric>
+    #include <vector>
+    #ifndef __cpp_lib_execution
+        #error "COO_EXECUTION: standard library without parallel algorithms"
+    #endif
+#endif
+
+/* include C API */
+#include "libcoocvt.h"
+
+/******************************************************************************/
+
+namespace coo
+{
+
+/*** array views ***/
+
+#if defined(__cpp_lib_span)
+
+/*!
+ * @brief contiguous array view, std::span with C++20
+ */
+template <typename T>
+using span = std::span<T>;
+
+#else
+
+/*!
+ * @brief contiguous array view, minimal replacement for std::span (C++17)
+ * @details non-owning pointer and size; constructible from pointer and size,
+ * from built-in arrays and from containers with data() and size(), e.g.
+ * std::vector and std::array
+ */
+template <typename T>
+class span
+{
+public:
+    using element_type = T;
+    using value_type   = std::remove_cv_t<T>;
+    using size_type    = std::size_t;
+    using pointer      = T*;
+    using reference    = T&;
+    using iterator     = T*;
+
+    constexpr span() noexcept = default;
+
+    constexpr span(T* ptr, const size_type len) noexcept
+        : ptr_(ptr), len_(len) {}
+
+    template <std::size_t N>
+    constexpr span(T (&arr)[N]) noexcept
+        : ptr_(arr), len_(N) {}
+
+    template <
+        class C,
+        class = std::enable_if_t<
+            !std::is_same_v<std::remove_cv_t<std::remove_reference_t<C>>, span>
+            && std::is_convertible_v<
+                decltype(std::declval<C&>().data()), T*
+            >
+        >
+    >
+    constexpr span(C&& cont) noexcept
+        : ptr_(cont.data()), len_(cont.size()) {}
+
+    /* non-const to const view */
+    template <
+        typename U,
+        class = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>
+    >
+    constexpr span(const span<U>& other) noexcept
+        : ptr_(other.data()), len_(other.size()) {}
+
+    constexpr pointer   data()  const noexcept { return ptr_; }
+    constexpr size_type size()  const noexcept { return len_; }
+    constexpr bool      empty() const noexcept { return len_ == 0; }
+    constexpr iterator  begin() const noexcept { return ptr_; }
+    constexpr iterator  end()   const noexcept { return ptr_ + len_; }
+
+    constexpr reference operator[](const size_type i) const noexcept
+    {
+        return ptr_[i];
+    }
+
+    constexpr span subspan(const size_type off, const size_type cnt) const noexcept
+    {
+        return span( ptr_ + off, cnt );
+    }
+
+private:
+    T*        ptr_ = nullptr;
+    size_type len_ = 0;
+}; // end span
+
+#endif
+
+/******************************************************************************/
+
+/*** constants ***/
+
+/*!
+ * @brief pi in precision of type T
+ */
+template <typename T>
+inline constexpr T pi = static_cast<T>(3.14159265358979323846264338327950288L);
+
+/*!
+ * @brief 2 pi in precision of type T
+ */
+template <typename T>
+inline constexpr T two_pi = static_cast<T>(6.28318530717958647692528676655900577L);
+
+/*!
+ * @brief Gaussian gravitational constant k in AU^(3/2) / (day Msun^(1/2))
+ */
+inline constexpr double gaussk = 0.01720209895;
+
+/******************************************************************************/
+
+/*** unit systems ***/
+
+/*!
+ * @brief astronomical units: AU, day and solar mass, G = k^2
+ * @details the default of the C API; a unit system is any class with a
+ * static constexpr member \a gm, the gravitational constant in its units
+ */
+struct gauss_units
+{
+    static constexpr double gm = 2.9591220828559115e-04; ///< k^2
+}; // end gauss_units
+
+/*!
+ * @brief AU, Julian year (365.25 days) and solar mass, G = (365.25 k)^2
+ */
+struct year_units
+{
+    static constexpr double gm = gauss_units::gm * 365.25 * 365.25; ///< ~4 pi^2
+}; // end year_units
+
+/*!
+ * @brief natural units with G = 1
+ */
+struct natural_units
+{
+    static constexpr double gm = 1.0; ///< G = 1
+}; // end natural_units
+
+/******************************************************************************/
+
+/*** type mapping ***/
+
+/*!
+ * @brief C structures for coordinates and elements of scalar type T
+ * @details specialized for float (#hcof_t, #helf_t) and double
+ * (#hco_t, #hel_t)
+ */
+template <typename T>
+struct real_traits
+{
+    static_assert( sizeof(T) == 0, "coo: scalar type must be float or double" );
+}; // end real_traits
+
+template <>
+struct real_traits<float>
+{
+    using hco = hcof_t; ///< coordinates
+    using hel = helf_t; ///< elements
+}; // end real_traits<float>
+
+template <>
+struct real_traits<double>
+{
+    using hco = hco_t;  ///< coordinates
+    using hel = hel_t;  ///< elements
+}; // end real_traits<double>
+
+/*!
+ * @brief heliocentric coordinates of scalar type T
+ */
+template <typename T>
+using hco = typename real_traits<T>::hco;
+
+/*!
+ * @brief heliocentric elements of scalar type T
+ */
+template <typename T>
+using hel = typename real_traits<T>::hel;
+
+/******************************************************************************/
+
+/*** single object kernels ***/
+
+namespace detail
+{
+
+/* instances of the template of the C kernels, overloaded for float and
+ * double: tm_kesolver(), tm_hco2hel_core(), tm_hel2hco_core(), ...
+ */
+#define TMPL_FN(fn)   fn
+#define TMPL_LINKAGE  inline
+#define TMPL_ST       float
+#define TMPL_HCO      hcof_t
+#define TMPL_HEL      helf_t
+#define TMPL_CT       float
+#define TMPL_CM(fn)   std::fn
+#define TMPL_CL(x)    x##f
+#define TMPL_KT       float
+#define TMPL_KM(fn)   std::fn
+#define TMPL_KL(x)    x##f
+#define TMPL_KITER    0
+#include "cvt_tmpl.h"
+
+#define TMPL_FN(fn)   fn
+#define TMPL_LINKAGE  inline
+#define TMPL_ST       double
+#define TMPL_HCO      hco_t
+#define TMPL_HEL      hel_t
+#define TMPL_CT       double
+#define TMPL_CM(fn)   std::fn
+#define TMPL_CL(x)    x
+#define TMPL_KT       double
+#define TMPL_KM(fn)   std::fn
+#define TMPL_KL(x)    x
+#define TMPL_KITER    0
+#include "cvt_tmpl.h"
+
+} // end namespace detail
+
+
+/*!
+ * @brief solver for Kepler Equation, see coo_kesolver()
+ * @details starter of Markley (1995) and one quintic correction
+ * @param[in] ecc eccentricity, 0 <= ecc < 1
+ * @param[in] ma mean anomaly in radians
+ * @return eccentric anomaly in radians, 0 <= E < 2 pi
+ */
+template <typename T>
+inline T kesolver(const T ecc, const T ma) noexcept
+{
+    static_assert(
+        std::is_same_v<T, float> || std::is_same_v<T, double>,
+        "coo: scalar type must be float or double"
+    );
+
+    return detail::tm_kesolver( ecc, ma );
+} // end kesolver
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates for a
+ * single object
+ * @param[out] coo resulting coordinates (pos only if \a with_vel is false)
+ * @param[in] ele source elements
+ * @param[in] mass sum of masses m0 + m of central body and object
+ * @param[in] with_vel whether to compute velocities
+ * @return true for success, false for invalid elements (a <= 0 or e outside
+ * [0, 1)), \a coo is not written then
+ */
+template <typename T, class Units = gauss_units>
+inline bool hel2hco(
+    hco<T>&       coo,
+    const hel<T>& ele,
+    const T       mass,
+    const bool    with_vel = true
+    ) noexcept
+{
+    const T mu = static_cast<T>(Units::gm) * mass;
+
+    return detail::tm_hel2hco_core( &coo, &ele, mu, with_vel ) == 0;
+} // end hel2hco
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements for a
+ * single object
+ * @param[out] ele resulting elements
+ * @param[in] coo source coordinates
+ * @param[in] mass sum of masses m0 + m of central body and object
+ * @return true for success, false for unbound or degenerate orbits
+ * (a <= 0 or e >= 1), \a ele is not written then
+ */
+template <typename T, class Units = gauss_units>
+inline bool hco2hel(
+    hel<T>&       ele,
+    const hco<T>& coo,
+    const T       mass
+    ) noexcept
+{
+    const T mu = static_cast<T>(Units::gm) * mass;
+
+    return detail::tm_hco2hel_core( &ele, &coo, mu, nullptr ) == 0;
+} // end hco2hel
+
+/******************************************************************************/
+
+/*** array kernels ***/
+
+namespace detail
+{
+
+/*!
+ * @brief check array sizes of a conversion, throws std::invalid_argument
+ */
+inline void check_sizes(
+    const std::size_t n,
+    const std::size_t nele,
+    const std::size_t nmass,
+    const std::size_t center,
+    const std::size_t nmask
+    )
+{
+    if ( (nele != n) || (nmass != n) )
+        throw std::invalid_argument( "coo: arrays of different size" );
+    if ( center >= n )
+        throw std::invalid_argument( "coo: index of central body out of range" );
+    if ( n > UINT32_MAX )
+        throw std::invalid_argument( "coo: too many objects" );
+    if ( (nmask != 0) && (nmask < COO_MASK_WORDS(n)) )
+        throw std::invalid_argument( "coo: status bitmap too small" );
+} // end check_sizes
+
+} // end namespace detail
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates for
+ * compact arrays, see hel2hco_arr()
+ * @details objects [first, first + count) in blocks of 64 objects, so that
+ * each word of \a mask is written once; \a first must be a multiple of 64,
+ * and so must \a count unless the range reaches the end of the arrays
+ * @param[out] coo coordinates
+ * @param[in] ele elements
+ * @param[in] mass masses
+ * @param[in] center index of central body
+ * @param[out] mask status bitmap, bit set for each failed object (may be
+ * empty)
+ * @param[in] with_vel whether to compute velocities
+ * @param[in] first index of first object, multiple of 64
+ * @param[in] count number of objects, multiple of 64 unless
+ * first + count == coo.size()
+ * @return number of failed objects
+ */
+template <typename T, class Units = gauss_units>
+inline std::uint32_t hel2hco_range(
+    span<hco<T>>          coo,
+    span<const hel<T>>    ele,
+    span<const T>         mass,
+    const std::size_t     center,
+    span<std::uint64_t>   mask,
+    const bool            with_vel,
+    const std::size_t     first,
+    const std::size_t     count
+    ) noexcept
+{
+    std::uint32_t nerr = 0;
+    const T       m0   = mass[center];
+
+    for (std::size_t lo = first; lo < first + count; lo += 64)
+    {
+        const std::size_t hi   = (first + count - lo < 64) ? first + count : lo + 64;
+        std::uint64_t     bits = 0;
+
+        for (std::size_t i = lo; i < hi; i++)
+        {
+            /* skip central object */
+            if ( i == center ) continue;
+
+            const std::uint64_t err =
+                !hel2hco<T, Units>( coo[i], ele[i], m0 + mass[i], with_vel );
+            bits |= err << (i - lo);
+            nerr += static_cast<std::uint32_t>(err);
+        } // end for
+
+        if ( !mask.empty() ) mask[lo / 64] = bits;
+    } // end for
+
+    return nerr;
+} // end hel2hco_range
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements for
+ * compact arrays, see hco2hel_arr() and hel2hco_range()
+ * @return number of failed objects
+ */
+template <typename T, class Units = gauss_units>
+inline std::uint32_t hco2hel_range(
+    span<hel<T>>          ele,
+    span<const hco<T>>    coo,
+    span<const T>         mass,
+    const std::size_t     center,
+    span<std::uint64_t>   mask,
+    const std::size_t     first,
+    const std::size_t     count
+    ) noexcept
+{
+    std::uint32_t nerr = 0;
+    const T       m0   = mass[center];
+
+    for (std::size_t lo = first; lo < first + count; lo += 64)
+    {
+        const std::size_t hi   = (first + count - lo < 64) ? first + count : lo + 64;
+        std::uint64_t     bits = 0;
+
+        for (std::size_t i = lo; i < hi; i++)
+        {
+            /* skip central object */
+            if ( i == center ) continue;
+
+            const std::uint64_t err =
+                !hco2hel<T, Units>( ele[i], coo[i], m0 + mass[i] );
+            bits |= err << (i - lo);
+            nerr += static_cast<std::uint32_t>(err);
+        } // end for
+
+        if ( !mask.empty() ) mask[lo / 64] = bits;
+    } // end for
+
+    return nerr;
+} // end hco2hel_range
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric coordinates for
+ * compact arrays
+ * @details usage: coo::hel2hco<double>( coo, ele, mass, 0 ), or
+ * coo::hel2hco<float, coo::year_units>( ... ); same semantics as
+ * hel2hco_arr(), but the per-object kernel is inlined and specialized
+ * @param[out] coo coordinates
+ * @param[in] ele elements, same size as \a coo
+ * @param[in] mass masses, same size as \a coo
+ * @param[in] center index of central body
+ * @param[out] mask status bitmap with COO_MASK_WORDS(size) entries, bit set
+ * for each failed object (may be empty)
+ * @return number of failed objects
+ * @throw std::invalid_argument for inconsistent array sizes
+ */
+template <typename T, class Units = gauss_units>
+inline std::uint32_t hel2hco(
+    span<hco<T>>        coo,
+    span<const hel<T>>  ele,
+    span<const T>       mass,
+    const std::size_t   center,
+    span<std::uint64_t> mask = {}
+    )
+{
+    detail::check_sizes( coo.size(), ele.size(), mass.size(), center, mask.size() );
+
+    coo[center] = hco<T>{};
+
+    return hel2hco_range<T, Units>( coo, ele, mass, center, mask, true, 0, coo.size() );
+} // end hel2hco
+
+
+/*!
+ * @brief convert heliocentric elements to heliocentric positions only for
+ * compact arrays, see hel2hco(); members coo[].vel are not written
+ * @return number of failed objects
+ * @throw std::invalid_argument for inconsistent array sizes
+ */
+template <typename T, class Units = gauss_units>
+inline std::uint32_t hel2hco_pos(
+    span<hco<T>>        coo,
+    span<const hel<T>>  ele,
+    span<const T>       mass,
+    const std::size_t   center,
+    span<std::uint64_t> mask = {}
+    )
+{
+    detail::check_sizes( coo.size(), ele.size(), mass.size(), center, mask.size() );
+
+    coo[center].pos = hco<T>{}.pos;
+
+    return hel2hco_range<T, Units>( coo, ele, mass, center, mask, false, 0, coo.size() );
+} // end hel2hco_pos
+
+
+/*!
+ * @brief convert heliocentric coordinates to heliocentric elements for
+ * compact arrays, see hel2hco()
+ * @param[out] ele elements
+ * @param[in] coo coordinates, same size as \a ele
+ * @param[in] mass masses, same size as \a ele
+ * @param[in] center index of central body
+ * @param[out] mask status bitmap with COO_MASK_WORDS(size) entries, bit set
+ * for each failed object (may be empty)
+ * @return number of failed objects
+ * @throw std::invalid_argument for inconsistent array sizes
+ */
+template <typename T, class Units = gauss_units>
+inline std::uint32_t hco2hel(
+    span<hel<T>>        ele,
+    span<const hco<T>>  coo,
+    span<const T>       mass,
+    const std::size_t   center,
+    span<std::uint64_t> mask = {}
+    )
+{
+    detail::check_sizes( ele.size(), coo.size(), mass.size(), center, mask.size() );
+
+    ele[center] = hel<T>{};
+
+    return hco2hel_range<T, Units>( ele, coo, mass, center, mask, 0, ele.size() );
+} // end hco2hel
+
+/******************************************************************************/
+
+/*** wrappers for the C API ***/
+
+/*!
+ * @brief owning handle for a conversion context, see coo_ctx_create()
+ * @details move-only; the raw pointer for the C API is returned by get()
+ */
+class context
+{
+public:
+    /*!
+     * @brief create a context with default settings
+     * @throw std::bad_alloc if out of memory
+     */
+    context() : ctx_( coo_ctx_create() )
+    {
+        if ( ctx_ == nullptr ) throw std::bad_alloc();
+    }
+
+    ~context() { coo_ctx_destroy( ctx_ ); }
+
+    context(const context&)            = delete;
+    context& operator=(const context&) = delete;
+
+    context(context&& other) noexcept
+        : ctx_( std::exchange( other.ctx_, nullptr ) ) {}
+
+    context& operator=(context&& other) noexcept
+    {
+        std::swap( ctx_, other.ctx_ );
+        return *this;
+    }
+
+    /*! @brief pointer for the C API */
+    coo_ctx_t* get() const noexcept { return ctx_; }
+
+    /*! @brief number of threads, see coo_ctx_set_threads() */
+    context& threads(const int n) noexcept
+    {
+        coo_ctx_set_threads( ctx_, n );
+        return *this;
+    }
+
+    /*! @brief gravitational constant, see coo_ctx_set_gm() */
+    context& gm(const double g) noexcept
+    {
+        coo_ctx_set_gm( ctx_, g );
+        return *this;
+    }
+
+    /*! @brief gravitational constant of a unit system */
+    template <class Units>
+    context& units() noexcept
+    {
+        return gm( Units::gm );
+    }
+
+private:
+    coo_ctx_t* ctx_ = nullptr;
+}; // end context
+
+
+/*!
+ * @brief coordinate conversion of an array of #body_t with the library's
+ * parallel kernels, see coocvt_oop()
+ * @param[in,out] ctx conversion context, settings and counters
+ * @param[in,out] obj array of type #body_t
+ * @param[in] center index of central body
+ * @param[in] mode conversion mode from enum #CVT_MODE_e
+ * @param[out] mask status bitmap with COO_MASK_WORDS(size) entries, bit set
+ * for each failed object (may be empty)
+ * @return number of failed objects
+ * @throw std::invalid_argument for invalid input or mode
+ */
+inline std::uint32_t convert(
+    context&            ctx,
+    span<body_t>        obj,
+    const std::size_t   center,
+    const CVT_MODE_e    mode,
+    span<std::uint64_t> mask = {}
+    )
+{
+    if ( (center >= obj.size()) || (obj.size() > UINT32_MAX) )
+        throw std::invalid_argument( "coo: index of central body out of range" );
+    if ( !mask.empty() && (mask.size() < COO_MASK_WORDS(obj.size())) )
+        throw std::invalid_argument( "coo: status bitmap too small" );
+
+    std::uint32_t nfail = 0;
+    if ( coo_ctx_cvt( ctx.get(), obj.data(), static_cast<std::uint32_t>(obj.size()),
+                      static_cast<std::uint32_t>(center), mode ) != 0 )
+        throw std::invalid_argument( "coo: conversion failed" );
+
+    const std::uint64_t* bits = coo_ctx_mask( ctx.get(), &nfail );
+    if ( !mask.empty() && (bits != nullptr) )
+    {
+        for (std::size_t w = 0; w < COO_MASK_WORDS(obj.size()); w++) mask[w] = bits[w];
+    }
+
+    return nfail;
+} // end convert
+
+/******************************************************************************/
+
+/*** parallel execution policies ***/
+
+#ifdef COO_EXECUTION
+
+namespace detail
+{
+
+/*!
+ * @brief true for the execution policies of <execution>
+ */
+template <class ExecutionPolicy>
+inline constexpr bool is_policy_v = std::is_execution_policy_v<
+    std::remove_cv_t<std::remove_reference_t<ExecutionPolicy>>
+>;
+
+/*!
+ * @brief convert an array of #body_t in blocks of 64 objects, scheduled by
+ * an execution policy, see coocvt_range()
+ * @return number of failed objects
+ */
+template <class ExecutionPolicy>
+inline std::uint32_t coocvt_policy(
+    ExecutionPolicy&&   policy,
+    const coo_ctx_t*    ctx,
+    span<body_t>        obj,
+    const std::size_t   center,
+    const CVT_MODE_e    mode,
+    span<std::uint64_t> mask
+    )
+{
+    /* check input here, since exceptions inside parallel algorithms terminate */
+    if ( (center >= obj.size()) || (obj.size() > UINT32_MAX) )
+        throw std::invalid_argument( "coo: index of central body out of range" );
+    if ( !mask.empty() && (mask.size() < COO_MASK_WORDS(obj.size())) )
+        throw std::invalid_argument( "coo: status bitmap too small" );
+
+    body_t* const        data = obj.data();
+    std::uint64_t* const bits = mask.empty() ? nullptr : mask.data();
+    const std::uint32_t  dim  = static_cast<std::uint32_t>(obj.size());
+    const std::uint32_t  ic   = static_cast<std::uint32_t>(center);
+
+    /* one task per word of the bitmap, holding its number of failed objects */
+    std::vector<std::uint32_t> nerr( COO_MASK_WORDS(dim) );
+    std::uint32_t* const       base = nerr.data();
+
+    std::for_each(
+        std::forward<ExecutionPolicy>(policy), nerr.begin(), nerr.end(),
+        [=](std::uint32_t& n) noexcept
+        {
+            const std::uint32_t w = static_cast<std::uint32_t>(&n - base);
+            (void)coocvt_range( ctx, data, dim, ic, mode, 64u * w, 64u, bits, &n );
+        }
+    );
+
+    return std::reduce( nerr.begin(), nerr.end(), std::uint32_t(0) );
+} // end coocvt_policy
+
+} // end namespace detail
+
+
+/*!
+ * @brief coordinate conversion of an array of #body_t, parallelized by a
+ * standard execution policy
+ * @details usage: coo::coocvt( std::execution::par_unseq, obj, 0,
+ * CVT_HCO2HEL ); the blocks of 64 objects of the library's kernels are
+ * distributed by the policy (e.g. over the TBB backend of the standard
+ * library) via coocvt_range(), instead of by OpenMP. Translations need
+ * sums over all objects and are done by coocvt_mask(). Requires
+ * COO_EXECUTION to be defined before including this header.
+ * @param[in] policy execution policy, e.g. std::execution::par
+ * @param[in,out] obj array of type #body_t
+ * @param[in] center index of central body
+ * @param[in] mode conversion mode from enum #CVT_MODE_e
+ * @param[out] mask status bitmap with COO_MASK_WORDS(size) entries, bit set
+ * for each failed object (may be empty)
+ * @return number of failed objects
+ * @throw std::invalid_argument for invalid input or mode
+ */
+template <
+    class ExecutionPolicy,
+    class = std::enable_if_t<detail::is_policy_v<ExecutionPolicy>>
+>
+inline std::uint32_t coocvt(
+    ExecutionPolicy&&   policy,
+    span<body_t>        obj,
+    const std::size_t   center,
+    const CVT_MODE_e    mode,
+    span<std::uint64_t> mask = {}
+    )
+{
+    switch ( mode )
+    {
+        case CVT_HCO2HEL:
+        case CVT_HEL2HCO:
+        case CVT_HEL2HCO_POS:
+            return detail::coocvt_policy(
+                std::forward<ExecutionPolicy>(policy), nullptr, obj, center, mode, mask
+            );
+
+        default:
+            break;
+    } // end switch
+
+    if ( (center >= obj.size()) || (obj.size() > UINT32_MAX) )
+        throw std::invalid_argument( "coo: index of central body out of range" );
+    if ( !mask.empty() && (mask.size() < COO_MASK_WORDS(obj.size())) )
+        throw std::invalid_argument( "coo: status bitmap too small" );
+
+    std::uint32_t nfail = 0;
+    if ( coocvt_mask( obj.data(), static_cast<std::uint32_t>(obj.size()),
+                      static_cast<std::uint32_t>(center), mode,
+                      mask.empty() ? nullptr : mask.data(), &nfail ) != 0 )
+        throw std::invalid_argument( "coo: conversion failed" );
+
+    return nfail;
+} // end coocvt
+
+
+/*!
+ * @brief coordinate conversion of an array of #body_t with the settings of
+ * a context, parallelized by a standard execution policy
+ * @details as coocvt() above; the gravitational constant is taken from
+ * \a ctx, its number of threads applies to translations only, which are
+ * done by coo_ctx_cvt() and update the counters of \a ctx
+ * @param[in] policy execution policy, e.g. std::execution::par
+ * @param[in,out] ctx conversion context
+ * @param[in,out] obj array of type #body_t
+ * @param[in] center index of central body
+ * @param[in] mode conversion mode from enum #CVT_MODE_e
+ * @param[out] mask status bitmap with COO_MASK_WORDS(size) entries, bit set
+ * for each failed object (may be empty)
+ * @return number of failed objects
+ * @throw std::invalid_argument for invalid input or mode
+ */
+template <
+    class ExecutionPolicy,
+    class = std::enable_if_t<detail::is_policy_v<ExecutionPolicy>>
+>
+inline std::uint32_t coocvt(
+    ExecutionPolicy&&   policy,
+    context&            ctx,
+    span<body_t>        obj,
+    const std::size_t   center,
+    const CVT_MODE_e    mode,
+    span<std::uint64_t> mask = {}
+    )
+{
+    switch ( mode )
+    {
+        case CVT_HCO2HEL:
+        case CVT_HEL2HCO:
+        case CVT_HEL2HCO_POS:
+            return detail::coocvt_policy(
+                std::forward<ExecutionPolicy>(policy), ctx.get(), obj, center, mode, mask
+            );
+
+        default:
+            return convert( ctx, obj, center, mode, mask );
+    } // end switch
+} // end coocvt
+
+#endif  /* COO_EXECUTION */
+
+} // end namespace coo
+
+/******************************************************************************/
+
+#endif  /* LIBCOOCVT__HPP */
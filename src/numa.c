@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * @file    numa.c
+ * @brief   NUMA topology and thread pinning for conversion contexts
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#define _GNU_SOURCE  /* for sched_setaffinity(), CPU_SET() */
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+/* include module headers */
+#include "numa.h"
+#include "context.h"
+
+/******************************************************************************/
+
+/*** pre-processor definitions ***/
+
+/* thread pinning available ? 1 = yes (Linux, GCC compatible), 0 = no */
+#if defined(__linux__) && defined(__GNUC__)
+    #define NUMA_LINUX 1
+#else
+    #define NUMA_LINUX 0
+#endif
+
+/* directory with NUMA topology */
+#define NUMA_SYSFS "/sys/devices/system/node"
+
+/******************************************************************************/
+
+#if NUMA_LINUX
+
+/*** internal variables ***/
+
+/* CPU the calling thread is pinned to, -1 = not pinned */
+static __thread int numa_cpu = -1;
+
+/* affinity of the calling thread before it was pinned */
+static __thread cpu_set_t numa_prev;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : parse_list
+ *  DESCRIPTION : read a list of numbers in sysfs format, e.g. "0-3,8-11"
+ *  INPUT       : - "path" of file
+ *                - array "list" for numbers
+ *                - maximum number "max" of entries in "list"
+ *  OUTPUT      : number of entries, -1 for error
+ ******************************************************************************/
+static int parse_list(
+    const char* path,
+    int         list[],
+    const int   max
+    )
+{
+    FILE* fp = fopen( path, "r" );
+    if ( fp == nullptr ) return -1;
+
+    int num = 0;
+    int lo, hi;
+    while ( fscanf( fp, "%d", &lo ) == 1 )
+    {
+        hi = lo;
+
+        /* range "lo-hi" */
+        int c = fgetc( fp );
+        if ( c == '-' )
+        {
+            if ( fscanf( fp, "%d", &hi ) != 1 ) break;
+            c = fgetc( fp );
+        } // end if
+
+        for (register int k = lo; (k <= hi) && (num < max); k++)
+        {
+            list[num++] = k;
+        } // end for
+
+        if ( c != ',' ) break;
+    } // end while
+
+    fclose( fp );
+
+    return num;
+} // end parse_list
+
+#endif  /* NUMA_LINUX */
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_numa_detect
+ *  DESCRIPTION : detect NUMA nodes and the CPUs usable by this process
+ *  INPUT       : - pointer "cpus" for new array of CPU numbers, by node
+ *                - pointer "ncpu" for number of entries in "cpus"
+ *                - pointer "nodes" for number of nodes with usable CPUs
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coo_numa_detect(
+    int**     cpus,
+    uint32_t* ncpu,
+    uint32_t* nodes
+    )
+{
+    /* check input */
+    if ( (cpus == nullptr) || (ncpu == nullptr) || (nodes == nullptr) )
+    {
+        return 1;
+    } // end if
+
+#if NUMA_LINUX
+    /* CPUs usable by the calling thread */
+    cpu_set_t allowed;
+    if ( sched_getaffinity( 0, sizeof(cpu_set_t), &allowed ) != 0 ) return 1;
+
+    /* online nodes */
+    int       node[CPU_SETSIZE];
+    const int nnode = parse_list( NUMA_SYSFS "/online", node, CPU_SETSIZE );
+    if ( nnode <= 0 ) return 1;
+
+    int* list = malloc( CPU_SETSIZE * sizeof(int) );
+    if ( list == nullptr ) return 1;
+
+    /* usable CPUs, grouped by node */
+    uint32_t num  = 0;
+    uint32_t used = 0;
+    for (register int n = 0; n < nnode; n++)
+    {
+        char path[64];
+        snprintf( path, sizeof(path), NUMA_SYSFS "/node%d/cpulist", node[n] );
+
+        int       cpu[CPU_SETSIZE];
+        const int k    = parse_list( path, cpu, CPU_SETSIZE );
+        uint32_t  prev = num;
+        for (register int j = 0; j < k; j++)
+        {
+            if ( (cpu[j] >= 0) && (cpu[j] < CPU_SETSIZE)
+                 && CPU_ISSET( cpu[j], &allowed ) && (num < CPU_SETSIZE) )
+            {
+                list[num++] = cpu[j];
+            } // end if
+        } // end for
+        if ( num > prev ) used++;
+    } // end for
+
+    if ( num == 0 )
+    {
+        free( list );
+        return 1;
+    } // end if
+
+    *cpus  = list;
+    *ncpu  = num;
+    *nodes = used;
+
+    return 0;
+#else
+    /* no topology information */
+    return 1;
+#endif
+} // end coo_numa_detect
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_numa_pin
+ *  DESCRIPTION : pin the calling thread of a parallel loop to its CPU
+ *  INPUT       : - pointer "ctx" to conversion context with NUMA mode
+ *  OUTPUT      : none
+ *  NOTE        : serial loops are not pinned; the previous affinity of the
+ *                thread is saved for coo_numa_unpin()
+ ******************************************************************************/
+void coo_numa_pin(const coo_ctx_t* ctx)
+{
+#if NUMA_LINUX && defined(_OPENMP)
+    const int nthr = omp_get_num_threads();
+    if ( nthr < 2 ) return;
+
+    /* spread threads evenly over the CPUs, ordered by node */
+    const size_t t   = (size_t)omp_get_thread_num();
+    const int    cpu = ctx->cpus[t * ctx->ncpu / (size_t)nthr];
+    if ( cpu == numa_cpu ) return;
+
+    /* save affinity, don't pin a thread which can't be restored */
+    if ( (numa_cpu < 0)
+         && (sched_getaffinity( 0, sizeof(cpu_set_t), &numa_prev ) != 0) )
+    {
+        return;
+    } // end if
+
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    CPU_SET( cpu, &set );
+    if ( sched_setaffinity( 0, sizeof(cpu_set_t), &set ) == 0 )
+    {
+        numa_cpu = cpu;
+    } // end if
+#else
+    (void)ctx;
+#endif
+
+    return;
+} // end coo_numa_pin
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_numa_unpin
+ *  DESCRIPTION : restore the affinity of the calling thread
+ *  INPUT       : - pointer "ctx" to conversion context with NUMA mode
+ *  OUTPUT      : none
+ *  NOTE        : called by every thread of the parallel region, which
+ *                restores the affinity saved by coo_numa_pin()
+ ******************************************************************************/
+void coo_numa_unpin(const coo_ctx_t* ctx)
+{
+    (void)ctx;
+
+#if NUMA_LINUX
+    if ( numa_cpu < 0 ) return;
+
+    if ( sched_setaffinity( 0, sizeof(cpu_set_t), &numa_prev ) == 0 )
+    {
+        numa_cpu = -1;
+    } // end if
+#endif
+
+    return;
+} // end coo_numa_unpin
+
+/******************************************************************************/
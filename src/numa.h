@@ -0,0 +1,88 @@
+/***************************************************************************//**
+ * @file    numa.h
+ * @brief   NUMA topology and thread pinning for conversion contexts
+ * @details internal header, topology is read from /sys/devices/system/node
+ *          on Linux; on other platforms NUMA mode is not available
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_NUMA__H
+#define COO_NUMA__H
+
+/******************************************************************************/
+
+/*** include pre-requisite headers ***/
+
+/* include module headers */
+#include "types.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief detect NUMA nodes and the CPUs usable by this process
+ * @param[out] cpus new array of CPU numbers ordered by node, release with
+ * free()
+ * @param[out] ncpu number of entries in \a cpus
+ * @param[out] nodes number of nodes with usable CPUs
+ * @return 0 for success, 1 for error (no topology information)
+ */
+int coo_numa_detect(
+    int**     cpus,
+    uint32_t* ncpu,
+    uint32_t* nodes
+);
+
+
+/*!
+ * @brief pin the calling thread of a parallel loop to its CPU (internal use)
+ * @details thread t of T is pinned to cpus[t * ncpu / T] of \a ctx, so that
+ * contiguous ranges of threads (and of objects under a static schedule)
+ * stay on one node; the previous affinity of each thread is saved
+ * @param[in] ctx conversion context with NUMA mode enabled
+ * @return none
+ */
+void coo_numa_pin(const coo_ctx_t* ctx);
+
+
+/*!
+ * @brief restore the affinity of the calling thread (internal use)
+ * @details resets the affinity saved by coo_numa_pin() if the calling
+ * thread has been pinned; called by each thread at the end of the parallel
+ * region that pinned it, so that no OpenMP worker thread stays pinned
+ * @param[in] ctx conversion context with NUMA mode enabled
+ * @return none
+ */
+void coo_numa_unpin(const coo_ctx_t* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* COO_NUMA__H */
@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * @file    stats.c
+ * @brief   optional runtime counters for coordinate conversions
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#define _POSIX_C_SOURCE 199309L  /* for clock_gettime() */
+#include <time.h>
+
+/* include module headers */
+#include "stats.h"
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_stats_ticks
+ *  DESCRIPTION : read CPU time stamp counter
+ *  INPUT       : none
+ *  OUTPUT      : ticks, nanoseconds on platforms without time stamp counter
+ ******************************************************************************/
+uint64_t coo_stats_ticks(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return( __builtin_ia32_rdtsc() );
+#else
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return( 1000000000ull * (uint64_t)ts.tv_sec + (uint64_t)ts.tv_nsec );
+#endif
+} // end coo_stats_ticks
+
+/******************************************************************************/
+
+#if COO_STATS
+
+/*** internal variables ***/
+
+/* counters for each conversion mode */
+static stats_t coo_stats[CVT_TOTAL_NUMBER];
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_stats_add
+ *  DESCRIPTION : add one conversion call to the counters of a mode;
+ *                safe to call from concurrent threads
+ *  INPUT       : - conversion "mode" from enum CVT_MODE_e
+ *                - number "num" of bodies processed
+ *                - number "fail" of bodies that failed to convert
+ *                - elapsed CPU "ticks"
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_stats_add(
+    const CVT_MODE_e mode,
+    const uint32_t   num,
+    const uint32_t   fail,
+    const uint64_t   ticks
+    )
+{
+    if ( (mode <= CVT_NONE) || (mode >= CVT_TOTAL_NUMBER) ) return;
+
+    stats_t* const s = &coo_stats[mode];
+
+#ifdef _OPENMP
+    #pragma omp atomic
+#endif
+    s->calls  += 1u;
+#ifdef _OPENMP
+    #pragma omp atomic
+#endif
+    s->bodies += num;
+#ifdef _OPENMP
+    #pragma omp atomic
+#endif
+    s->fails  += fail;
+#ifdef _OPENMP
+    #pragma omp atomic
+#endif
+    s->ticks  += ticks;
+
+    return;
+} // end coo_stats_add
+
+#endif  /* COO_STATS */
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_stats_get
+ *  DESCRIPTION : read runtime counters of a conversion mode
+ *  INPUT       : - pointer "stats" of type stats_t
+ *                - conversion "mode" from enum CVT_MODE_e
+ *  OUTPUT      : 0 for success, 1 for error (invalid mode or counters disabled)
+ ******************************************************************************/
+int coo_stats_get(
+    stats_t*         stats,
+    const CVT_MODE_e mode
+    )
+{
+    if ( stats == nullptr ) return 1;
+
+    stats->calls  = 0;
+    stats->bodies = 0;
+    stats->fails  = 0;
+    stats->ticks  = 0;
+
+    if ( (mode <= CVT_NONE) || (mode >= CVT_TOTAL_NUMBER) ) return 1;
+
+#if COO_STATS
+    const stats_t* const s = &coo_stats[mode];
+#ifdef _OPENMP
+    #pragma omp atomic read
+#endif
+    stats->calls  = s->calls;
+#ifdef _OPENMP
+    #pragma omp atomic read
+#endif
+    stats->bodies = s->bodies;
+#ifdef _OPENMP
+    #pragma omp atomic read
+#endif
+    stats->fails  = s->fails;
+#ifdef _OPENMP
+    #pragma omp atomic read
+#endif
+    stats->ticks  = s->ticks;
+    return 0;
+#else
+    /* counters compiled out */
+    return 1;
+#endif
+} // end coo_stats_get
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_stats_reset
+ *  DESCRIPTION : reset runtime counters of all conversion modes to zero
+ *  INPUT       : none
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_stats_reset(void)
+{
+#if COO_STATS
+    for (register int mode = 0; mode < CVT_TOTAL_NUMBER; mode++)
+    {
+#ifdef _OPENMP
+        #pragma omp atomic write
+#endif
+        coo_stats[mode].calls  = 0;
+#ifdef _OPENMP
+        #pragma omp atomic write
+#endif
+        coo_stats[mode].bodies = 0;
+#ifdef _OPENMP
+        #pragma omp atomic write
+#endif
+        coo_stats[mode].fails  = 0;
+#ifdef _OPENMP
+        #pragma omp atomic write
+#endif
+        coo_stats[mode].ticks  = 0;
+    } // end for
+#endif
+
+    return;
+} // end coo_stats_reset
+
+/******************************************************************************/
@@ -0,0 +1,116 @@
+/***************************************************************************//**
+ * @file    stats.h
+ * @brief   optional runtime counters for coordinate conversions
+ * @details counting is compiled out by default, build the library with
+ *          -DCOO_STATS=1 to enable it
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_STATS__H
+#define COO_STATS__H
+
+/******************************************************************************/
+
+/*** include pre-requisite headers ***/
+
+/* include module headers */
+#include "types.h"
+#include "coocvt.h"
+
+/******************************************************************************/
+
+/*** pre-processor definitions ***/
+
+/* collect runtime counters ? 0 = no (default), 1 = yes */
+#ifndef COO_STATS
+    #define COO_STATS 0
+#endif
+
+/* hooks for conversion functions, expand to nothing if counters are disabled */
+#if COO_STATS
+    #define COO_STATS_TICKS()                   coo_stats_ticks()
+    #define COO_STATS_ADD(mode,num,fail,start)  \
+        coo_stats_add( (mode), (num), (fail), coo_stats_ticks() - (start) )
+#else
+    #define COO_STATS_TICKS()                   0u
+    #define COO_STATS_ADD(mode,num,fail,start)  ((void)(start), (void)(fail))
+#endif
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief read CPU time stamp counter (internal use)
+ * @details available also with disabled counters, for per-context statistics
+ * @return ticks, nanoseconds on platforms without time stamp counter
+ */
+uint64_t coo_stats_ticks(void);
+
+#if COO_STATS
+
+/*!
+ * @brief add one conversion call to the counters of a mode (internal use)
+ * @param[in] mode conversion mode from enum #CVT_MODE_e
+ * @param[in] num number of bodies processed
+ * @param[in] fail number of bodies that failed to convert
+ * @param[in] ticks elapsed CPU ticks
+ * @return none
+ */
+void coo_stats_add(
+    const CVT_MODE_e mode,
+    const uint32_t   num,
+    const uint32_t   fail,
+    const uint64_t   ticks
+);
+#endif
+
+
+/*!
+ * @brief read runtime counters of a conversion mode
+ * @param[out] stats counters of type #stats_t, zero if disabled
+ * @param[in] mode conversion mode from enum #CVT_MODE_e
+ * @return 0 for success, 1 for error (invalid mode or counters disabled)
+ */
+int coo_stats_get(
+    stats_t*         stats,
+    const CVT_MODE_e mode
+);
+
+
+/*!
+ * @brief reset runtime counters of all conversion modes to zero
+ * @return none
+ */
+void coo_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* COO_STATS__H */
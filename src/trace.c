@@ -0,0 +1,343 @@
+/*******************************************************************************
+ * @file    trace.c
+ * @brief   opt-in tracer writing Chrome trace-event JSON
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#define _GNU_SOURCE  /* for clock_gettime(), syscall() */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__linux__)
+    #include <sys/syscall.h>
+#endif
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+/* include module headers */
+#include "trace.h"
+
+/******************************************************************************/
+
+/*** pre-processor definitions ***/
+
+/* show verbose debugging output ? 0 = no (default), 1 = yes */
+#define COO_TRACE_DEBUG 0
+
+/******************************************************************************/
+
+/*** internal data structures ***/
+
+/* single trace event */
+typedef struct
+{
+    const char* name;  // name of phase
+    uint64_t    ts;    // time stamp in nanoseconds
+    uint32_t    tid;   // thread ID
+    uint32_t    num;   // number of bodies
+    char        phase; // 'B' = begin, 'E' = end
+} trace_ev_t;
+
+/******************************************************************************/
+
+/*** global and internal variables ***/
+
+bool coo_trace_enabled = false;
+
+static trace_ev_t* trace_buf  = nullptr;  // event buffer
+static uint32_t    trace_cap  = 0;        // capacity of buffer
+static uint32_t    trace_len  = 0;        // number of reserved events
+static uint32_t    trace_drop = 0;        // number of dropped events
+static uint32_t    trace_busy = 0;        // number of events being recorded
+static char*       trace_path = nullptr;  // name of output file
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : trace_now
+ *  DESCRIPTION : monotonic time stamp
+ *  INPUT       : none
+ *  OUTPUT      : time in nanoseconds
+ ******************************************************************************/
+static uint64_t trace_now(void)
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return( 1000000000ull * (uint64_t)ts.tv_sec + (uint64_t)ts.tv_nsec );
+} // end trace_now
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : trace_tid
+ *  DESCRIPTION : ID of calling thread
+ *  INPUT       : none
+ *  OUTPUT      : system thread ID (Linux), OpenMP thread number otherwise
+ ******************************************************************************/
+static uint32_t trace_tid(void)
+{
+#if defined(__linux__)
+    return( (uint32_t)syscall( SYS_gettid ) );
+#elif defined(_OPENMP)
+    return( (uint32_t)omp_get_thread_num() );
+#else
+    return 0;
+#endif
+} // end trace_tid
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : trace_string
+ *  DESCRIPTION : write string to file as JSON string literal
+ *  INPUT       : - pointer "fp" to FILE object
+ *                - string "str"
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void trace_string(
+    FILE*       fp,
+    const char* str
+    )
+{
+    fputc( '"', fp );
+    for (const char* c = str; *c != '\0'; c++)
+    {
+        if ( (*c == '"') || (*c == '\\') ) fputc( '\\', fp );
+        if ( (unsigned char)*c >= 0x20 ) fputc( *c, fp );
+    } // end for
+    fputc( '"', fp );
+} // end trace_string
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_trace_event
+ *  DESCRIPTION : record a single trace event; safe to call from concurrent
+ *                threads, events beyond capacity are dropped
+ *  NOTE        : the event is counted in "trace_busy" while it is written,
+ *                so that coo_trace_stop() doesn't release the buffer early
+ *  INPUT       : - "name" of phase
+ *                - event type "phase", 'B' for begin and 'E' for end
+ *                - number "num" of bodies processed
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_trace_event(
+    const char*    name,
+    const char     phase,
+    const uint32_t num
+    )
+{
+    const uint64_t ts = trace_now();
+
+    /* announce event, then check again whether the tracer is active */
+    __atomic_add_fetch( &trace_busy, 1u, __ATOMIC_SEQ_CST );
+    if ( !__atomic_load_n( &coo_trace_enabled, __ATOMIC_SEQ_CST ) )
+    {
+        __atomic_sub_fetch( &trace_busy, 1u, __ATOMIC_RELEASE );
+        return;
+    } // end if
+
+    /* reserve slot in buffer; GCC atomics rather than "omp atomic", which
+     * is a plain increment without OpenMP, also for threads of the caller
+     */
+    const uint32_t idx = __atomic_fetch_add( &trace_len, 1u, __ATOMIC_RELAXED );
+
+    if ( idx >= trace_cap )
+    {
+        __atomic_fetch_add( &trace_drop, 1u, __ATOMIC_RELAXED );
+    } // end if
+    else
+    {
+        trace_buf[idx].name  = name;
+        trace_buf[idx].ts    = ts;
+        trace_buf[idx].tid   = trace_tid();
+        trace_buf[idx].num   = num;
+        trace_buf[idx].phase = phase;
+    } // end else
+
+    __atomic_sub_fetch( &trace_busy, 1u, __ATOMIC_RELEASE );
+
+    return;
+} // end coo_trace_event
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_trace_start
+ *  DESCRIPTION : start recording trace events
+ *  INPUT       : - name "path" of output file
+ *                - maximum number "capacity" of events
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coo_trace_start(
+    const char*    path,
+    const uint32_t capacity
+    )
+{
+    /* check input */
+    if ( (path == nullptr) || (capacity == 0) || COO_TRACE_ON() )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+
+    trace_buf  = malloc( (size_t)capacity * sizeof(trace_ev_t) );
+    trace_path = malloc( strlen( path ) + 1 );
+    if ( (trace_buf == nullptr) || (trace_path == nullptr) )
+    {
+        free( trace_buf );
+        free( trace_path );
+        trace_buf  = nullptr;
+        trace_path = nullptr;
+        return 1;
+    } // end if
+
+    strcpy( trace_path, path );
+    trace_cap  = capacity;
+    trace_len  = 0;
+    trace_drop = 0;
+
+    /* publish buffer before events are recorded */
+    __atomic_store_n( &coo_trace_enabled, true, __ATOMIC_SEQ_CST );
+
+    return 0;
+} // end coo_trace_start
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_trace_stop
+ *  DESCRIPTION : stop recording and write trace events to JSON file in
+ *                Chrome trace-event format (time stamps in microseconds,
+ *                relative to the earliest event)
+ *  INPUT       : none
+ *  OUTPUT      : 0 for success, 1 for error
+ *  NOTE        : not allowed inside of a parallel region, where other
+ *                threads of the team could still record events; events of
+ *                concurrent threads outside of it are waited for
+ ******************************************************************************/
+int coo_trace_stop(void)
+{
+#ifdef _OPENMP
+    if ( omp_in_parallel() )
+    {
+        /* TODO print error message */
+        return 1;
+    } // end if
+#endif
+
+    if ( !__atomic_exchange_n( &coo_trace_enabled, false, __ATOMIC_SEQ_CST ) )
+    {
+        return 1;
+    } // end if
+
+    /* wait for events being recorded */
+    while ( __atomic_load_n( &trace_busy, __ATOMIC_ACQUIRE ) != 0 ) {}
+
+    FILE* fp = fopen( trace_path, "w" );
+    if ( fp == nullptr )
+    {
+#if COO_TRACE_DEBUG
+        fprintf( stderr, "%s: Error = cannot open %s\n", __func__, trace_path );
+#endif
+        free( trace_buf );
+        free( trace_path );
+        trace_buf  = nullptr;
+        trace_path = nullptr;
+        return 1;
+    } // end if
+
+    const uint32_t num = (trace_len < trace_cap) ? trace_len : trace_cap;
+    const int      pid = (int)getpid();
+
+    /* slots are reserved after the time stamp is taken, so the first
+     * event need not be the earliest one
+     */
+    uint64_t t0 = (num > 0) ? trace_buf[0].ts : 0;
+    for (register uint32_t k = 1; k < num; k++)
+    {
+        if ( trace_buf[k].ts < t0 ) t0 = trace_buf[k].ts;
+    } // end for
+
+    fprintf( fp, "{\n\"traceEvents\": [\n" );
+    for (register uint32_t k = 0; k < num; k++)
+    {
+        const trace_ev_t* ev = &trace_buf[k];
+        fprintf( fp, "{\"name\": " );
+        trace_string( fp, ev->name );
+        fprintf(
+            fp,
+            ", \"cat\": \"coocvt\", \"ph\": \"%c\", \"ts\": %.3f, "
+            "\"pid\": %d, \"tid\": %u, \"args\": {\"bodies\": %u}}%s\n",
+            ev->phase, 1.0e-3 * (double)(ev->ts - t0), pid, ev->tid, ev->num,
+            (k + 1 < num) ? "," : ""
+        );
+    } // end for
+    fprintf(
+        fp,
+        "],\n\"displayTimeUnit\": \"ns\",\n"
+        "\"otherData\": {\"dropped\": %u}\n}\n",
+        trace_drop
+    );
+
+    const int ret = (fclose( fp ) == 0) ? 0 : 1;
+
+    free( trace_buf );
+    free( trace_path );
+    trace_buf  = nullptr;
+    trace_path = nullptr;
+    trace_cap  = 0;
+
+    return ret;
+} // end coo_trace_stop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_trace_begin
+ *  DESCRIPTION : mark begin of a user-defined phase in the trace
+ *  INPUT       : "name" of phase
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_trace_begin(const char* name)
+{
+    COO_TRACE_BEGIN( name, 0 );
+} // end coo_trace_begin
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_trace_end
+ *  DESCRIPTION : mark end of a user-defined phase in the trace
+ *  INPUT       : "name" of phase
+ *  OUTPUT      : none
+ ******************************************************************************/
+void coo_trace_end(const char* name)
+{
+    COO_TRACE_END( name, 0 );
+} // end coo_trace_end
+
+/******************************************************************************/
@@ -0,0 +1,137 @@
+/***************************************************************************//**
+ * @file    trace.h
+ * @brief   opt-in tracer writing Chrome trace-event JSON
+ * @details records begin and end events of library phases (input, conversion,
+ *          output) with thread IDs; the files can be loaded in
+ *          chrome://tracing or Perfetto
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_TRACE__H
+#define COO_TRACE__H
+
+/******************************************************************************/
+
+/*** include pre-requisite headers ***/
+
+/* include standard headers */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* include module headers */
+#include "types.h"
+
+/******************************************************************************/
+
+/*** global variables ***/
+
+/* tracer active ? true between coo_trace_start() and coo_trace_stop(),
+ * accessed with atomic operations only
+ */
+extern bool coo_trace_enabled;
+
+/******************************************************************************/
+
+/*** pre-processor definitions ***/
+
+/* tracer active ? relaxed atomic load, coo_trace_event() checks again */
+#define COO_TRACE_ON() __atomic_load_n( &coo_trace_enabled, __ATOMIC_RELAXED )
+
+/* hooks for library functions, a single branch if tracer is not active */
+#define COO_TRACE_BEGIN(name,num)                               \
+    do {                                                        \
+        if ( COO_TRACE_ON() ) coo_trace_event( (name), 'B', (num) ); \
+    } while (0)
+
+#define COO_TRACE_END(name,num)                                 \
+    do {                                                        \
+        if ( COO_TRACE_ON() ) coo_trace_event( (name), 'E', (num) ); \
+    } while (0)
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief record a single trace event (internal use)
+ * @param[in] name name of phase, must be a string literal or outlive the tracer
+ * @param[in] phase event type, 'B' for begin and 'E' for end
+ * @param[in] num number of bodies processed, stored as event argument
+ * @return none
+ */
+void coo_trace_event(
+    const char*    name,
+    const char     phase,
+    const uint32_t num
+);
+
+
+/*!
+ * @brief start recording trace events
+ * @details events are kept in memory and written by coo_trace_stop(), events
+ * beyond \a capacity are dropped and counted
+ * @param[in] path name of output file for JSON trace
+ * @param[in] capacity maximum number of events
+ * @return 0 for success, 1 for error (already active or out of memory)
+ */
+int coo_trace_start(
+    const char*    path,
+    const uint32_t capacity
+);
+
+
+/*!
+ * @brief stop recording and write trace events to JSON file
+ * @details must be called outside of parallel regions; waits for events
+ * being recorded by other threads before the buffer is released
+ * @return 0 for success, 1 for error (not active, called in a parallel
+ * region or file error)
+ */
+int coo_trace_stop(void);
+
+
+/*!
+ * @brief mark begin of a user-defined phase in the trace
+ * @param[in] name name of phase, must be a string literal or outlive the tracer
+ * @return none
+ */
+void coo_trace_begin(const char* name);
+
+
+/*!
+ * @brief mark end of a user-defined phase in the trace
+ * @param[in] name name of phase, same as for coo_trace_begin()
+ * @return none
+ */
+void coo_trace_end(const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* COO_TRACE__H */
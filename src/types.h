@@ -39,10 +39,12 @@
 /*** include prerequisite headers ***/
 
 /* include standard headers */
+#include <stddef.h>
 #include <stdint.h>
 
 /* include module headers */
 #include "vec3d.h"
+#include "vec3f.h"
 #include "vec4d.h"
 
 /******************************************************************************/
@@ -52,6 +54,65 @@
 /* declare new C++ 2011-like "keyword" for NULL pointer */
 #define nullptr ((void*)0)
 
+/*!
+ * @brief C99 restrict qualifier, also usable from C++ headers
+ */
+#ifdef __cplusplus
+    #define COO_RESTRICT __restrict__
+#else
+    #define COO_RESTRICT restrict
+#endif
+
+/*!
+ * @brief number of 64-bit words for a per-object status bitmap
+ * @details bit (i % 64) of word (i / 64) is set if object i failed to convert
+ */
+#define COO_MASK_WORDS(dim)   (((dim) + 63u) / 64u)
+
+
+/*!
+ * @brief test status bit of object \a i in bitmap \a mask
+ */
+#define COO_MASK_TEST(mask,i) (((mask)[(i) >> 6] >> ((i) & 63u)) & 1u)
+
+
+/*!
+ * @brief allocation flags for coo_alloc_bodies() and coo_alloc_soa()
+ * @details may be combined with bitwise or; huge pages are a hint and
+ * silently fall back to normal pages if not available
+ */
+#define COO_ALLOC_DEFAULT   0u  ///< 64-byte aligned, zero-initialised
+#define COO_ALLOC_HUGE      1u  ///< transparent huge pages (madvise)
+#define COO_ALLOC_HUGETLB   2u  ///< explicit huge pages (MAP_HUGETLB)
+#define COO_ALLOC_PREFAULT  4u  ///< touch all pages with the context's threads
+
+
+/*!
+ * @brief column of #view_t for member \a member of an array of structs of
+ * type \a type starting at \a base
+ * @details e.g. COO_COL(part, particle_t, pos[0]) for the x components of
+ * a caller-owned array "part"; the member must be of type double
+ */
+#define COO_COL(base,type,member) \
+    ((col_t){ (double*)((char*)(base) + offsetof(type, member)), sizeof(type) })
+
+
+/*!
+ * @brief build a hot kernel for several x86-64 ISA levels (AVX-512, AVX2,
+ * baseline) and select the best variant at load time via GNU ifunc
+ * @details attach it to the function that contains the loop (for OpenMP, the
+ * function with the parallel region, whose outlined body is cloned with it),
+ * not to wrappers that only call such a function;
+ * define COO_NO_DISPATCH to build baseline code only
+ */
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 6) \
+    && defined(__x86_64__) && defined(__linux__) && !defined(COO_NO_DISPATCH)
+    #define COO_DISPATCH \
+        __attribute__((target_clones("avx512f","avx2","default")))
+#else
+    #define COO_DISPATCH
+#endif
+
 /******************************************************************************/
 
 /*** define data structures ***/
@@ -112,6 +173,33 @@ typedef struct
 } hel_t;
 
 
+/*!
+ * @brief Heliocentric Cartesian Coordinates in single precision
+ * @details same layout as #hco_t with components of type #vec3f_t,
+ * for screening and visualization of large object sets
+ */
+typedef struct
+{
+    vec3f_t pos; ///< position
+    vec3f_t vel; ///< velocity
+} hcof_t;
+
+
+/*!
+ * @brief Heliocentric Keplerian orbital elements in single precision
+ * @details same layout as #hel_t, only for elliptic motion (0 < ecc < 1)
+ */
+typedef struct
+{
+    float sma; ///< semi-major axis
+    float ecc; ///< eccentricity
+    float inc; ///< inclination
+    float aph; ///< argument of perihelion
+    float lan; ///< longitude of ascending node
+    float man; ///< mean anomaly
+} helf_t;
+
+
 /*!
  * @brief Heliocentric (elliptic) Delaunay elements (DEL)
  * @details canonical action-angle elements
@@ -127,6 +215,130 @@ typedef struct
 } del_t;
 
 
+/*!
+ * @brief matrix of partial derivatives (Jacobian) for a single object
+ * @details 6x6 matrix with m[row][col] = d(out[row]) / d(in[col]), using
+ * the order (x, y, z, vx, vy, vz) for Cartesian coordinates and the order
+ * (sma, ecc, inc, aph, lan, man) of #hel_t for Keplerian elements
+ */
+typedef struct
+{
+    double m[6][6]; ///< matrix elements, row-major
+} jac_t;
+
+
+/*!
+ * @brief persistent accumulator for barycenter (center of mass) sums
+ * @details compensated running sums of total mass and mass-weighted position
+ * and velocity, allowing O(1) updates when single objects change
+ */
+typedef struct
+{
+    double   sum[7]; ///< sums of m, m*x, m*y, m*z, m*vx, m*vy, m*vz
+    double   err[7]; ///< compensation terms for \a sum
+    uint32_t count;  ///< number of objects in accumulator
+} bcacc_t;
+
+
+/*!
+ * @brief runtime counters for one coordinate conversion mode
+ * @details only collected if the library is built with -DCOO_STATS=1,
+ * see coo_stats_get()
+ */
+typedef struct
+{
+    uint64_t calls;  ///< number of conversion calls
+    uint64_t bodies; ///< number of bodies processed
+    uint64_t fails;  ///< number of bodies that failed to convert (e.g. e >= 1)
+    uint64_t ticks;  ///< cumulative CPU time stamp counter ticks
+} stats_t;
+
+
+/*!
+ * @brief cached orientation matrix of an orbit
+ * @details first two columns P, Q of the rotation from the orbital plane to
+ * the reference frame, keyed on the angles they were computed for; see
+ * coo_orient_init() and hel2hco_cached()
+ */
+typedef struct
+{
+    double inc;  ///< inclination of cache key
+    double aph;  ///< argument of pericenter of cache key
+    double lan;  ///< longitude of ascending node of cache key
+    double p[3]; ///< unit vector towards pericenter
+    double q[3]; ///< unit vector in orbital plane, 90 deg ahead of \a p
+} orient_t;
+
+
+/*!
+ * @brief opaque conversion context, see coo_ctx_create()
+ * @details owns settings (threads, gravitational constant), scratch buffers
+ * and statistics of one independent simulation
+ */
+typedef struct coo_ctx coo_ctx_t;
+
+
+/*!
+ * @brief structure-of-arrays storage for heliocentric coordinates, elements
+ * and masses of many objects
+ * @details all arrays are 64-byte aligned and hold \a dim entries, see
+ * coo_alloc_soa()
+ */
+typedef struct
+{
+    uint32_t dim;  ///< number of objects
+    double*  x;    ///< heliocentric position, x component
+    double*  y;    ///< heliocentric position, y component
+    double*  z;    ///< heliocentric position, z component
+    double*  vx;   ///< heliocentric velocity, x component
+    double*  vy;   ///< heliocentric velocity, y component
+    double*  vz;   ///< heliocentric velocity, z component
+    double*  sma;  ///< semi-major axis
+    double*  ecc;  ///< eccentricity
+    double*  inc;  ///< inclination
+    double*  aph;  ///< argument of perihelion
+    double*  lan;  ///< longitude of ascending node
+    double*  man;  ///< mean anomaly
+    double*  mass; ///< mass in units of solar mass
+} body_soa_t;
+
+
+/*!
+ * @brief strided column of doubles in caller-owned memory
+ * @details entry i is at byte address ptr + i * stride, see #COO_COL
+ */
+typedef struct
+{
+    double* ptr;    ///< address of entry 0
+    size_t  stride; ///< distance of consecutive entries in bytes
+} col_t;
+
+
+/*!
+ * @brief view of caller-owned object data for in-place conversions
+ * @details one column per coordinate, element and mass, so that the
+ * conversion kernels read and write any array-of-structs or
+ * structure-of-arrays layout directly, see coocvt_view()
+ */
+typedef struct
+{
+    uint32_t dim;  ///< number of objects
+    col_t    x;    ///< heliocentric position, x component
+    col_t    y;    ///< heliocentric position, y component
+    col_t    z;    ///< heliocentric position, z component
+    col_t    vx;   ///< heliocentric velocity, x component
+    col_t    vy;   ///< heliocentric velocity, y component
+    col_t    vz;   ///< heliocentric velocity, z component
+    col_t    sma;  ///< semi-major axis
+    col_t    ecc;  ///< eccentricity
+    col_t    inc;  ///< inclination
+    col_t    aph;  ///< argument of perihelion
+    col_t    lan;  ///< longitude of ascending node
+    col_t    man;  ///< mean anomaly
+    col_t    mass; ///< mass in units of solar mass
+} view_t;
+
+
 /*!
  * @brief collection of coordinates for a single object
  * @details using \a hel as generic elements for any kind of Cartesian coord.
@@ -30,9 +30,13 @@
  ******************************************************************************/
 /* include standard headers */
 #include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
 
 /* include module headers */
 #include "utils.h"
+#include "csum.h"
+#include "context.h"
 
 /******************************************************************************/
 
@@ -44,6 +48,12 @@
     #include <stdio.h>
 #endif
 
+/* block size for parallel reductions, number of objects */
+#define COO_REDUCE_BLOCK  4096u
+
+/* maximum number of blocks, block size grows for larger arrays */
+#define COO_REDUCE_MAXBLK 256u
+
 /******************************************************************************/
 
 /***
@@ -68,6 +78,9 @@ const rco_t   rco_zero = {{0.0, 0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0, 0.0}};
 const del_t   del_zero = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
 const hel_t   hel_zero = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
 
+/* matrix of partial derivatives */
+const jac_t   jac_zero = {{{0.0}}};
+
 /******************************************************************************/
 
 /*******************************************************************************
@@ -95,130 +108,272 @@ inline double coo_total_mass(
 /******************************************************************************/
 
 /*******************************************************************************
- *  FUNCTION    : coo_total_mass_cs
- *  DESCRIPTION : compensated summation version of function coo_total_mass()
- *  INPUT       : - pointer to array "obj" of type body_t
+ *  FUNCTION    : sum_mass
+ *  DESCRIPTION : compensated sum of masses, using CSUM_LANES independent
+ *                lanes which are merged at the end
+ *  INPUT       : - pointer "sum" for sum of masses
+ *                - pointer "err" for compensation term of "sum"
+ *                - pointer to array "obj" of type body_t
  *                - starting index "fromIdx"
  *                - final index "uptoIdx"
- *  OUTPUT      : sum of values between "fromIdx" and "uptoIdx" - 1
+ *  OUTPUT      : none
+ *  NOTE        : the result does not depend on the compiler's choice to
+ *                vectorize the lanes or not
  ******************************************************************************/
-inline double coo_total_mass_cs(
+static inline void sum_mass(
+    double*        sum,
+    double*        err,
     const body_t   obj[],
     const uint32_t fromIdx,
     const uint32_t uptoIdx
     )
 {
-    /* NOTE 'volatile' avoids optimization of this variable (?) */
-    volatile double errm;
-    double newm, oldm, incm;
+    double ls[CSUM_LANES] = {0.0}; // lane sums
+    double le[CSUM_LANES] = {0.0}; // lane errors
+
+    /***
+     * TODO leave the compensated sums exactly as they are !!!
+     * NOTE don't use gcc -funsafe optimizations
+     ***/
+    register uint32_t idx = fromIdx;
+    for ( ; uptoIdx - idx >= CSUM_LANES; idx += CSUM_LANES)
+    {
+        for (register uint32_t k = 0; k < CSUM_LANES; k++)
+        {
+            csum_twosum( &ls[k], &le[k], obj[idx + k].mass );
+        } // end for
+    } // end for
 
-    errm = newm = oldm = 0.0;
-    for (register uint32_t idx = fromIdx; idx < uptoIdx; idx++)
+    /* remaining entries go to first lane */
+    for ( ; idx < uptoIdx; idx++)
     {
-        incm = errm + obj[idx].mass;    // mass increment
-        newm = oldm + incm;             // new total mass
-        /***
-         * TODO leave this statement exactly as it is !!!
-         * NOTE don't use gcc -funsafe optimizations
-         ***/
-        errm = (oldm - newm) + incm;    // update error variable
-        oldm = newm;
+        csum_twosum( &ls[0], &le[0], obj[idx].mass );
     } // end for
-    return( newm );
-} // end coo_total_mass_cs
+
+    /* merge lanes */
+    *sum = ls[0];
+    *err = le[0];
+    for (register uint32_t k = 1; k < CSUM_LANES; k++)
+    {
+        csum_merge( sum, err, ls[k], le[k] );
+    } // end for
+} // end sum_mass
 
 /******************************************************************************/
 
-/* helper function for barycentric coordinates */
-static inline void getBarycenter_BCO(
-    body_t         src[],
-    hco_t*         bc,
+/*******************************************************************************
+ *  FUNCTION    : sum_weighted
+ *  DESCRIPTION : compensated sums of masses and of mass-weighted positions
+ *                and velocities in a single pass
+ *  INPUT       : - array "sum" for sums of m, m*x, m*y, m*z, m*vx, m*vy, m*vz
+ *                - array "err" for compensation terms of "sum"
+ *                - pointer to array "src" of type body_t
+ *                - byte "offset" of hco_t member in body_t, e.g. for obj[].hco
+ *                - starting index "fromIdx"
+ *                - final index "uptoIdx"
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void sum_weighted(
+    double         sum[7],
+    double         err[7],
+    const body_t   src[],
+    const size_t   offset,
     const uint32_t fromIdx,
     const uint32_t uptoIdx
     )
 {
-    /* sum up mass-weighted positions & velocities */
-    for (register uint32_t i = fromIdx; i < uptoIdx; i++)
+    double ls[7][CSUM_LANES] = {{0.0}}; // lane sums
+    double le[7][CSUM_LANES] = {{0.0}}; // lane errors
+
+    register uint32_t idx = fromIdx;
+    for ( ; uptoIdx - idx >= CSUM_LANES; idx += CSUM_LANES)
     {
-        // bc = bc + src[i] * mass[i]
-        vec3d_madd(&bc->pos, &bc->pos, &src[i].bco.pos, src[i].mass);
-        vec3d_madd(&bc->vel, &bc->vel, &src[i].bco.vel, src[i].mass);
+        for (register uint32_t k = 0; k < CSUM_LANES; k++)
+        {
+            const body_t* const b = &src[idx + k];
+            const hco_t*  const c = (const hco_t*)((const char*)b + offset);
+            const double        m = b->mass;
+
+            csum_twosum( &ls[0][k], &le[0][k], m );
+            csum_twosum( &ls[1][k], &le[1][k], m * c->pos.x );
+            csum_twosum( &ls[2][k], &le[2][k], m * c->pos.y );
+            csum_twosum( &ls[3][k], &le[3][k], m * c->pos.z );
+            csum_twosum( &ls[4][k], &le[4][k], m * c->vel.x );
+            csum_twosum( &ls[5][k], &le[5][k], m * c->vel.y );
+            csum_twosum( &ls[6][k], &le[6][k], m * c->vel.z );
+        } // end for
     } // end for
-} // end getBarycenter_BCO
 
-/******************************************************************************/
+    /* remaining entries go to first lane */
+    for ( ; idx < uptoIdx; idx++)
+    {
+        const body_t* const b = &src[idx];
+        const hco_t*  const c = (const hco_t*)((const char*)b + offset);
+        const double        m = b->mass;
+
+        csum_twosum( &ls[0][0], &le[0][0], m );
+        csum_twosum( &ls[1][0], &le[1][0], m * c->pos.x );
+        csum_twosum( &ls[2][0], &le[2][0], m * c->pos.y );
+        csum_twosum( &ls[3][0], &le[3][0], m * c->pos.z );
+        csum_twosum( &ls[4][0], &le[4][0], m * c->vel.x );
+        csum_twosum( &ls[5][0], &le[5][0], m * c->vel.y );
+        csum_twosum( &ls[6][0], &le[6][0], m * c->vel.z );
+    } // end for
 
-/* helper function for heliocentric coordinates */
-static inline void getBarycenter_HCO(
-    body_t         src[],
-    hco_t*         bc,
-    const uint32_t fromIdx,
-    const uint32_t uptoIdx
-    )
-{
-    /* sum up mass-weighted positions & velocities */
-    for (register uint32_t i = fromIdx; i < uptoIdx; i++)
+    /* merge lanes */
+    for (register int q = 0; q < 7; q++)
     {
-        // bc = bc + src[i] * mass[i]
-        vec3d_madd(&bc->pos, &bc->pos, &src[i].hco.pos, src[i].mass);
-        vec3d_madd(&bc->vel, &bc->vel, &src[i].hco.vel, src[i].mass);
+        sum[q] = ls[q][0];
+        err[q] = le[q][0];
+        for (register uint32_t k = 1; k < CSUM_LANES; k++)
+        {
+            csum_merge( &sum[q], &err[q], ls[q][k], le[q][k] );
+        } // end for
     } // end for
-} // end getBarycenter_HCO
+} // end sum_weighted
 
 /******************************************************************************/
 
-/* helper function for Jacobi coordinates */
-static inline void getBarycenter_JCO(
-    body_t         src[],
-    hco_t*         bc,
+/*******************************************************************************
+ *  FUNCTION    : reduce_blocks
+ *  DESCRIPTION : reproducible (parallel) reduction for sums of masses and
+ *                of mass-weighted positions and velocities
+ *  INPUT       : - array "sum" for sums of m, m*x, m*y, m*z, m*vx, m*vy, m*vz
+ *                - array "err" for compensation terms of "sum"
+ *                - pointer to array "src" of type body_t
+ *                - byte "offset" of hco_t member in body_t, e.g. for obj[].hco
+ *                - starting index "fromIdx"
+ *                - final index "uptoIdx"
+ *                - Boolean "mass_only", only sum[0] and err[0] are set
+ *                - number of threads "nthr" for the partial sums
+ *  OUTPUT      : none
+ *  NOTE        : the range is split into blocks whose size depends only on
+ *                the number of objects; partial sums of the blocks (computed
+ *                in parallel if OpenMP is enabled) are merged in a fixed
+ *                pairwise tree, so the result is bit-identical for any
+ *                number of threads and any schedule
+ ******************************************************************************/
+COO_DISPATCH static void reduce_blocks(
+    double         sum[7],
+    double         err[7],
+    const body_t   src[],
+    const size_t   offset,
     const uint32_t fromIdx,
-    const uint32_t uptoIdx
+    const uint32_t uptoIdx,
+    const bool     mass_only,
+    const int      nthr
     )
 {
-    /* sum up mass-weighted positions & velocities */
-    for (register uint32_t i = fromIdx; i < uptoIdx; i++)
+    double psum[COO_REDUCE_MAXBLK][7]; // partial sums of blocks
+    double perr[COO_REDUCE_MAXBLK][7]; // partial errors of blocks
+
+    /* fixed block layout: depends only on number of objects */
+    const uint32_t num  = uptoIdx - fromIdx;
+    uint32_t       bsiz = (num + COO_REDUCE_MAXBLK - 1u) / COO_REDUCE_MAXBLK;
+    if ( bsiz < COO_REDUCE_BLOCK ) bsiz = COO_REDUCE_BLOCK;
+    const int      nblk = (num == 0) ? 1 : (int)((num + bsiz - 1u) / bsiz);
+    const int      nq   = mass_only ? 1 : 7;
+
+    /* partial sums per block, with trace events of each thread */
+#ifdef _OPENMP
+    #pragma omp parallel num_threads(nthr) if((nblk > 1) && (nthr > 1))
+#else
+    (void)nthr;
+#endif
+    {
+        uint32_t nsum = 0; // number of objects summed by this thread
+        COO_TRACE_BEGIN( __func__, 0 );
+
+#ifdef _OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for (int b = 0; b < nblk; b++)
+        {
+            const uint32_t lo = fromIdx + (uint32_t)b * bsiz;
+            const uint32_t hi = (uptoIdx - lo < bsiz) ? uptoIdx : lo + bsiz;
+            if ( mass_only )
+            {
+                sum_mass( &psum[b][0], &perr[b][0], src, lo, hi );
+            } // end if
+            else
+            {
+                sum_weighted( psum[b], perr[b], src, offset, lo, hi );
+            } // end else
+            nsum += hi - lo;
+        } // end for
+
+        COO_TRACE_END( __func__, nsum );
+    } // end parallel
+
+    /* merge partial sums in fixed pairwise tree */
+    for (int stride = 1; stride < nblk; stride *= 2)
+    {
+        for (int b = 0; b + stride < nblk; b += 2 * stride)
+        {
+            for (register int q = 0; q < nq; q++)
+            {
+                csum_merge(
+                    &psum[b][q], &perr[b][q],
+                    psum[b + stride][q], perr[b + stride][q]
+                );
+            } // end for
+        } // end for
+    } // end for
+
+    for (register int q = 0; q < nq; q++)
     {
-        // bc = bc + src[i] * mass[i]
-        vec3d_madd(&bc->pos, &bc->pos, &src[i].jco.pos, src[i].mass);
-        vec3d_madd(&bc->vel, &bc->vel, &src[i].jco.vel, src[i].mass);
+        sum[q] = psum[0][q];
+        err[q] = perr[0][q];
     } // end for
-} // end getBarycenter_JCO
+} // end reduce_blocks
 
 /******************************************************************************/
 
-/* helper function for Poincare coordinates */
-static inline void getBarycenter_PCO(
-    body_t         src[],
-    hco_t*         bc,
+/*******************************************************************************
+ *  FUNCTION    : coo_total_mass_cs
+ *  DESCRIPTION : compensated summation version of function coo_total_mass()
+ *  INPUT       : - pointer to array "obj" of type body_t
+ *                - starting index "fromIdx"
+ *                - final index "uptoIdx"
+ *  OUTPUT      : sum of values between "fromIdx" and "uptoIdx" - 1
+ *  NOTE        : the result is bit-identical for any number of threads
+ ******************************************************************************/
+double coo_total_mass_cs(
+    const body_t   obj[],
     const uint32_t fromIdx,
     const uint32_t uptoIdx
     )
 {
-    /* sum up mass-weighted positions & velocities */
-    for (register uint32_t i = fromIdx; i < uptoIdx; i++)
-    {
-        // bc = bc + src[i] * mass[i]
-        vec3d_madd(&bc->pos, &bc->pos, &src[i].pco.pos, src[i].mass);
-        vec3d_madd(&bc->vel, &bc->vel, &src[i].pco.vel, src[i].mass);
-    } // end for
-} // end getBarycenter_PCO
+    double sum[7], err[7];
+
+    /* check array indices */
+    if ( uptoIdx <= fromIdx ) return 0.0;
+
+    reduce_blocks( sum, err, obj, 0, fromIdx, uptoIdx, true, 1 );
+    return( csum_get( sum[0], err[0] ) );
+} // end coo_total_mass_cs
 
 /******************************************************************************/
 
 /*******************************************************************************
- *  FUNCTION    : getBarycenter
+ *  FUNCTION    : coo_get_barycenter_ctx
  *  DESCRIPTION : determine barycenter position and velocity
- *  INPUT       : - pointer to array of type hco_t for source coordinates "src"
+ *                using the settings of a conversion context
+ *  INPUT       : - pointer "ctx" to conversion context (may be nullptr)
  *                - pointer of type hco_t to barycenter coordinates "bc"
- *                - pointer to array "mass"
+ *                - pointer to array of type body_t for source coordinates "src"
  *                - starting index "fromIdx"
  *                - final index "uptoIdx"
  *                - coordinate "type" from enum COO_TYPE_e
  *  OUTPUT      : 0 for success, 1 for error
+ *  NOTE        : total mass and mass-weighted sums are accumulated with
+ *                compensated summation in a single pass over "src";
+ *                the result is bit-identical for any number of threads
  ******************************************************************************/
-int coo_get_barycenter(
+int coo_get_barycenter_ctx(
+    const coo_ctx_t* ctx,
     hco_t*           bc,
-    body_t           src[],
+    const body_t     src[],
     const uint32_t   fromIdx,
     const uint32_t   uptoIdx,
     const COO_TYPE_e type
@@ -238,30 +393,28 @@ int coo_get_barycenter(
         return 1;
     } // end if
 
-    /* reset all barycenter components to zero */
-    *bc = hco_zero;
-
     /* select which type of coordinates */
+    size_t offset;
     switch ( type )
     {
         /* barycentric coordinates */
         case COO_BCO:
-            getBarycenter_BCO( src, bc, fromIdx, uptoIdx );
+            offset = offsetof( body_t, bco );
             break;
 
         /* heliocentric coordinates */
         case COO_HCO:
-            getBarycenter_HCO( src, bc, fromIdx, uptoIdx );
+            offset = offsetof( body_t, hco );
             break;
 
         /* Jacobi coordinates */
         case COO_JCO:
-            getBarycenter_JCO( src, bc, fromIdx, uptoIdx );
+            offset = offsetof( body_t, jco );
             break;
 
         /* Poincare coordinates */
         case COO_PCO:
-            getBarycenter_PCO( src, bc, fromIdx, uptoIdx );
+            offset = offsetof( body_t, pco );
             break;
 
         /* TODO FIXME implement barycenter for case COO_RCO */
@@ -273,16 +426,54 @@ int coo_get_barycenter(
             return 1;
     } // end switch
 
+    /* sum up masses and mass-weighted positions & velocities */
+    double sum[7], err[7];
+    reduce_blocks(
+        sum, err, src, offset, fromIdx, uptoIdx, false,
+        coo_ctx_threads( ctx, 1 )
+    );
+
     /* inverse of total mass */
-    const double mtot = 1.0 / coo_total_mass_cs( src, fromIdx, uptoIdx );
+    const double mtot = 1.0 / csum_get( sum[0], err[0] );
 
     /* scale with total mass of system:
      * bc = bc * mtot
      */
-    vec3d_smul( &bc->pos, &bc->pos, mtot ); // position vector component
-    vec3d_smul( &bc->vel, &bc->vel, mtot ); // velocity vector component
+    *bc = hco_zero;
+    bc->pos.x = csum_get( sum[1], err[1] ) * mtot; // position vector component
+    bc->pos.y = csum_get( sum[2], err[2] ) * mtot;
+    bc->pos.z = csum_get( sum[3], err[3] ) * mtot;
+    bc->vel.x = csum_get( sum[4], err[4] ) * mtot; // velocity vector component
+    bc->vel.y = csum_get( sum[5], err[5] ) * mtot;
+    bc->vel.z = csum_get( sum[6], err[6] ) * mtot;
 
     return 0;
+} // end coo_get_barycenter_ctx
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_get_barycenter
+ *  DESCRIPTION : determine barycenter position and velocity
+ *  INPUT       : - pointer of type hco_t to barycenter coordinates "bc"
+ *                - pointer to array of type body_t for source coordinates "src"
+ *                - starting index "fromIdx"
+ *                - final index "uptoIdx"
+ *                - coordinate "type" from enum COO_TYPE_e
+ *  OUTPUT      : 0 for success, 1 for error
+ *  NOTE        : total mass and mass-weighted sums are accumulated with
+ *                compensated summation in a single pass over "src";
+ *                the result is bit-identical for any number of threads
+ ******************************************************************************/
+int coo_get_barycenter(
+    hco_t*           bc,
+    body_t           src[],
+    const uint32_t   fromIdx,
+    const uint32_t   uptoIdx,
+    const COO_TYPE_e type
+    )
+{
+    return( coo_get_barycenter_ctx( nullptr, bc, src, fromIdx, uptoIdx, type ) );
 } // end coo_get_barycenter
 
 /******************************************************************************/
@@ -46,6 +46,7 @@ extern const bco_t   bco_zero;
 extern const del_t   del_zero;
 extern const hco_t   hco_zero;
 extern const hel_t   hel_zero;
+extern const jac_t   jac_zero;
 extern const jco_t   jco_zero;
 extern const pco_t   pco_zero;
 extern const rco_t   rco_zero;
@@ -77,6 +78,29 @@ int coo_get_barycenter(
 );
 
 
+/*!
+ * @brief determine barycenter (center of mass) position & velocity
+ * using the settings of a conversion context
+ * @details identical to coo_get_barycenter(), but with the number of threads
+ * taken from \a ctx; the result does not depend on this number
+ * @param[in] ctx conversion context (may be nullptr for default settings)
+ * @param[out] bc coordinates for center of mass (barycenter)
+ * @param[in] obj input array of type #body_t
+ * @param[in] fromIdx lowest index in array \a obj
+ * @param[in] uptoIdx highest index in array \a obj
+ * @param[in] type coordinate type from enum #COO_TYPE_e
+ * @return 0 for success, 1 for error
+ */
+int coo_get_barycenter_ctx(
+    const coo_ctx_t* ctx,
+    hco_t*           bc,
+    const body_t     obj[],
+    const uint32_t   fromIdx,
+    const uint32_t   uptoIdx,
+    const COO_TYPE_e type
+);
+
+
 /*!
  * @brief shift coordinates relative to new center
  * @details translates source coordinates to new coordinate center via
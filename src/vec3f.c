@@ -0,0 +1,430 @@
+/*******************************************************************************
+ * @file    vec3f.c
+ * @brief   module defining a single-precision structure vec3f_t and
+ *          utility functions for it
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+
+/* include module headers */
+#include "vec3f.h"
+
+/******************************************************************************/
+
+/***
+ * vec3f_inner
+ * inner (scalar) product of two vectors; a & b can be the same vector
+ * <a|b> = a.x * b.x + a.y * b.y + a.z * b.z
+ ***/
+inline float vec3f_inner(
+    const vec3f_t* const a,
+    const vec3f_t* const b
+    )
+{
+    return( a->x * b->x + a->y * b->y + a->z * b->z );
+} // end vec3f_inner
+
+/******************************************************************************/
+
+/***
+ * vec3f_abs
+ * absolute value of a vector (Euclidean norm)
+ * <v|v>^1/2
+ ***/
+inline float vec3f_abs(const vec3f_t* const v)
+{
+    return( sqrtf(v->x * v->x + v->y * v->y + v->z * v->z) );
+} // end vec3f_abs
+
+/******************************************************************************/
+
+/***
+ * vec3f_add
+ * addition of two vectors
+ * a + b = (a.x + b.x, a.y + b.y, a.z + b.z)
+ * NOTE no update of dest->abs because of possible side effects
+ ***/
+inline void vec3f_add(
+    vec3f_t*             dest,
+    const vec3f_t* const a,
+    const vec3f_t* const b
+    )
+{
+    dest->x = a->x + b->x;
+    dest->y = a->y + b->y;
+    dest->z = a->z + b->z;
+} // end vec3f_add
+
+/***
+ * vec3f_add_v
+ * addition of two vectors
+ * function returns a vector
+ ***/
+inline vec3f_t vec3f_add_v(
+    const vec3f_t* const a,
+    const vec3f_t* const b
+    )
+{
+    return(
+        (vec3f_t){
+            .x = a->x + b->x,
+            .y = a->y + b->y,
+            .z = a->z + b->z,
+            .abs = 0.0f
+        }
+    );
+} // end vec3f_add_v
+
+/******************************************************************************/
+
+/***
+ * vec3f_angle
+ * angle between two vectors
+ * cos(angle) = <a|b> / (|a| * |b|)
+ * NOTE uses vec3f_abs() & vec3f_inner(), functions must already be defined
+ ***/
+inline float vec3f_angle(
+    const vec3f_t* const a,
+    const vec3f_t* const b
+    )
+{
+    const float den = vec3f_abs(a) * vec3f_abs(b); /* denominator */
+    if ( den > 0.0f )
+    {
+        const float num = vec3f_inner(a, b); /* numerator */
+        return( acosf(num / den) );
+    } // end if
+    else return 0.0f;
+} // end vec3f_angle
+
+/******************************************************************************/
+
+/***
+ * vec3f_ipow3
+ * power -3 of absolute value
+ * 1 / |v|^3
+ * NOTE no update of v->abs because of possible side effects
+ ***/
+inline float vec3f_ipow3(const vec3f_t* const v)
+{
+    const float tmp = vec3f_abs(v);
+    if ( tmp > 0.0f )
+    {
+        return( 1.0f / (tmp * tmp * tmp) );
+    } // end if
+    else return 0.0f;
+} // end vec3f_ipow3
+
+/******************************************************************************/
+
+/***
+ * vec3f_madd
+ * multiply a vector with a scalar and add to another vector
+ * dest = v + w * scalar
+ * NOTE no update of dest->abs because of possible side effects
+ ***/
+inline void vec3f_madd(
+    vec3f_t*             dest,
+    const vec3f_t* const v,
+    const vec3f_t* const w,
+    const float          scalar
+    )
+{
+    dest->x = v->x + w->x * scalar;
+    dest->y = v->y + w->y * scalar;
+    dest->z = v->z + w->z * scalar;
+} // end vec3f_madd
+
+/***
+ * vec3f_madd_v
+ * multiply a vector with a scalar and add to another vector
+ * function returns a vector
+ ***/
+inline vec3f_t vec3f_madd_v(
+    const vec3f_t* const v,
+    const vec3f_t* const w,
+    const float          scalar
+    )
+{
+    return(
+        (vec3f_t){
+            .x = v->x + w->x * scalar,
+            .y = v->y + w->y * scalar,
+            .z = v->z + w->z * scalar,
+            .abs = 0.0f
+        }
+    );
+} // end vec3f_madd_v
+
+/******************************************************************************/
+
+/***
+ * vec3f_madd2
+ * multiply and add two vectors and scalars
+ * dest = a * v + b * w
+ * a,b = scalar
+ * v,w = vector
+ * NOTE no update of dest->abs because of possible side effects
+ ***/
+inline void vec3f_madd2(
+    vec3f_t*             dest,
+    const float          a,
+    const vec3f_t* const v,
+    const float          b,
+    const vec3f_t* const w
+    )
+{
+    dest->x = a * v->x + b * w->x;
+    dest->y = a * v->y + b * w->y;
+    dest->z = a * v->z + b * w->z;
+} // end vec3f_madd2
+
+/***
+ * vec3f_madd2_v
+ * multiply and add two vectors and scalars
+ * function returns a vector
+ ***/
+inline vec3f_t vec3f_madd2_v(
+    const float          a,
+    const vec3f_t* const v,
+    const float          b,
+    const vec3f_t* const w
+    )
+{
+    return(
+        (vec3f_t){
+            .x = a * v->x + b * w->x,
+            .y = a * v->y + b * w->y,
+            .z = a * v->z + b * w->z,
+            .abs = 0.0f
+        }
+    );
+} // end vec3f_madd2_v
+
+/******************************************************************************/
+
+/***
+ * vec3f_matvec
+ * product of a matrix with a vector
+ * dest = A * v
+ * NOTE no update of dest->abs because of possible side effects
+ ***/
+inline void vec3f_matvec(
+    vec3f_t*             dest,
+    const vec3f_t        mat[],
+    const vec3f_t* const vec
+    )
+{
+    dest->x = vec3f_inner( &mat[0], vec );
+    dest->y = vec3f_inner( &mat[1], vec );
+    dest->z = vec3f_inner( &mat[2], vec );
+} // end vec3f_matvec
+
+/***
+ * vec3f_matvec_v
+ * product of a matrix with a vector
+ * function returns a vector
+ ***/
+inline vec3f_t vec3f_matvec_v(
+    const vec3f_t        mat[],
+    const vec3f_t* const vec
+    )
+{
+    return(
+        (vec3f_t){
+            .x = vec3f_inner( &mat[0], vec ),
+            .y = vec3f_inner( &mat[1], vec ),
+            .z = vec3f_inner( &mat[2], vec ),
+            .abs = 0.0f
+        }
+    );
+} // end vec3f_matvec_v
+
+/******************************************************************************/
+
+/***
+ * vec3f_outer
+ * outer (cross) product of two vectors
+ * a x b = (a.y*b.z-a.z*b.y, a.z*b.x-a.x*b.z, a.x*b.y-a.y*b.x)
+ * NOTE no update of dest->abs because of possible side effects
+ ***/
+inline void vec3f_outer(
+    vec3f_t*             dest,
+    const vec3f_t* const a,
+    const vec3f_t* const b
+    )
+{
+    dest->x = a->y * b->z - a->z * b->y;
+    dest->y = a->z * b->x - a->x * b->z;
+    dest->z = a->x * b->y - a->y * b->x;
+} // end vec3f_outer
+
+/***
+ * vec3f_outer_v
+ * outer (cross) product of two vectors
+ * function returns a vector
+ ***/
+inline vec3f_t vec3f_outer_v(
+    const vec3f_t* const a,
+    const vec3f_t* const b
+    )
+{
+    return(
+        (vec3f_t){
+            .x = a->y * b->z - a->z * b->y,
+            .y = a->z * b->x - a->x * b->z,
+            .z = a->x * b->y - a->y * b->x,
+            .abs = 0.0f
+        }
+    );
+} // end vec3f_outer_v
+
+/******************************************************************************/
+
+/***
+ * vec3f_scale
+ * scale a vector to an unit vector (length = 1)
+ * dest = src / |src|
+ ***/
+inline int vec3f_scale(
+    vec3f_t*             dest,
+    const vec3f_t* const src
+    )
+{
+    dest->abs = vec3f_abs( src );
+    if ( dest->abs > 0.0f )
+    {
+        vec3f_smul( dest, src, 1.0f / dest->abs );
+        dest->abs = 1.0f;
+        return 1;
+    } // end if
+    else return 0;
+} // end vec3f_scale
+
+/******************************************************************************/
+
+/***
+ * vec3f_scale2
+ * scale a vector to the given length "len"
+ * dest = len * src / |src|
+ ***/
+inline int vec3f_scale2(
+    vec3f_t*             dest,
+    const vec3f_t* const src,
+    const float          len
+    )
+{
+    dest->abs = vec3f_abs( src );
+    if ( dest->abs > 0.0f )
+    {
+        vec3f_smul( dest, src, len / dest->abs );
+        dest->abs = len;
+        return 1;
+    } // end if
+    else return 0;
+} // end vec3f_scale2
+
+/* TODO FIXME implement function
+ * vec3f_t vec3f_scale2_v(v, len)
+ */
+
+/******************************************************************************/
+
+/***
+ * vec3f_smul
+ * multiplication of a vector with a scalar
+ * dest = s * v = (s * v.x, s * v.y, s * v.z)
+ * NOTE no update of dest->abs because of possible side effects
+ ***/
+inline void vec3f_smul(
+    vec3f_t*             dest,
+    const vec3f_t* const v,
+    const float          scalar
+    )
+{
+    dest->x = scalar * v->x;
+    dest->y = scalar * v->y;
+    dest->z = scalar * v->z;
+} // end vec3f_smul
+
+/***
+ * vec3f_smul_v
+ * multiplication of a vector with a scalar
+ * function returns a vector
+ ***/
+inline vec3f_t vec3f_smul_v(
+    const vec3f_t* const v,
+    const float          scalar
+    )
+{
+    return(
+        (vec3f_t){
+            .x = scalar * v->x,
+            .y = scalar * v->y,
+            .z = scalar * v->z,
+            .abs = 0.0f
+        }
+    );
+} // end vec3f_smul_v
+
+/******************************************************************************/
+
+/***
+ * vec3f_sub
+ * calculate the difference of two vectors
+ * a - b = (a.x - b.x, a.y - b.y, a.z - b.z)
+ * NOTE no update of dest->abs because of possible side effects
+ ***/
+inline void vec3f_sub(
+    vec3f_t*             dest,
+    const vec3f_t* const a,
+    const vec3f_t* const b
+    )
+{
+    dest->x = a->x - b->x;
+    dest->y = a->y - b->y;
+    dest->z = a->z - b->z;
+} // end vec3f_sub
+
+/***
+ * vec3f_sub_v
+ * calculate the difference of two vectors
+ * function returns a vector
+ ***/
+inline vec3f_t vec3f_sub_v(
+    const vec3f_t* const a,
+    const vec3f_t* const b
+    )
+{
+    return(
+        (vec3f_t){
+            .x = a->x - b->x,
+            .y = a->y - b->y,
+            .z = a->z - b->z,
+            .abs = 0.0f
+        }
+    );
+} // end vec3f_sub_v
+
+/******************************************************************************/
@@ -0,0 +1,344 @@
+/***************************************************************************//**
+ * @file    vec3f.h
+ * @brief   module defining a single-precision structure vec3f_t and
+ *          utility functions for it
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef VEC_3F__H
+#define VEC_3F__H
+
+/******************************************************************************/
+
+/*!
+ * @brief type definition for a 3-dimensional vector in single precision
+ * @details using \a abs for padding to size of 4x float,
+ * also using \a abs to store absolute value of vector
+ */
+typedef struct
+{
+    float x;    ///< x component
+    float y;    ///< y component
+    float z;    ///< z component
+    float abs;  ///< absolute value as Euclidean norm
+} vec3f_t;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+/*!
+ * @brief calculate the absolute value of a vector
+ * @verbatim abs = <v|v>^(1/2) @endverbatim
+ * @param[in] v pointer to the vector of type #vec3f_t
+ * @return absolute value (Euclidean norm) as scalar
+ */
+float vec3f_abs(const vec3f_t* const v);
+
+
+/*!
+ * @brief calculate the addition (sum) of two vectors
+ * @verbatim dest = v + w @endverbatim
+ * @param[out] dest pointer to resulting vector of type #vec3f_t
+ * @param[in] v pointer to first source vector of type #vec3f_t
+ * @param[in] w pointer to second source vector of type #vec3f_t
+ * @return none
+ */
+void vec3f_add(
+    vec3f_t*             dest,
+    const vec3f_t* const v,
+    const vec3f_t* const w
+);
+
+
+/*!
+ * @brief calculate the addition (sum) of two vectors
+ * @details special form that returns a vector
+ * @verbatim dest = v + w @endverbatim
+ * @param[in] v pointer to first source vector of type #vec3f_t
+ * @param[in] w pointer to second source vector of type #vec3f_t
+ * @return resulting vector of type #vec3f_t
+ */
+vec3f_t vec3f_add_v(
+    const vec3f_t* const v,
+    const vec3f_t* const w
+);
+
+
+/*!
+ * @brief calculate the angle between two vectors
+ * @verbatim cos(angle) = <v|w> / (|v|*|w|) @endverbatim
+ * @details if \a v or \a w have length 0, then angle = 0 is returned
+ * \f[ \cos \phi = \frac{ \langle v | w \rangle }{ |v| \; |w| } \f]
+ * @param[in] v pointer to first source vector of type #vec3f_t
+ * @param[in] w pointer to second source vector of type #vec3f_t
+ * @return angle as scalar value (in radians)
+ */
+float vec3f_angle(
+    const vec3f_t* const v,
+    const vec3f_t* const w
+);
+
+
+/*!
+ * @brief calculate the inner (scalar) product of two vectors
+ * @verbatim prod = <v|w> @endverbatim
+ * @param[in] v pointer to first source vector of type #vec3f_t
+ * @param[in] w pointer to second source vector of type #vec3f_t
+ * @return inner product as scalar value
+ */
+float vec3f_inner(
+    const vec3f_t* const v,
+    const vec3f_t* const w
+);
+
+
+/*!
+ * @brief calculate the absolute value of a vector to the power -3
+ * @verbatim pow = |v|^(-3) @endverbatim
+ * \f[ \frac{1}{|v|^3} \f]
+ * @param[in] v pointer to the source vector of type #vec3f_t
+ * @return absoulute value raised to the power -3 as scalar
+ */
+float vec3f_ipow3(const vec3f_t* const v);
+
+
+/*!
+ * @brief multiply-and-add of two vectors and one scalar
+ * @verbatim dest = v + w * s @endverbatim
+ * @param[out] dest pointer to resulting vector of type #vec3f_t
+ * @param[in] v pointer to the first source vector of type #vec3f_t
+ * @param[in] w pointer to the second source vector of type #vec3f_t
+ * @param[in] s scalar value for scaling second vector
+ * @return none
+ */
+void vec3f_madd(
+    vec3f_t*             dest,
+    const vec3f_t* const v,
+    const vec3f_t* const w,
+    const float          s
+);
+
+
+/*!
+ * @brief multiply-and-add of two vectors and one scalar
+ * @verbatim dest = v + w * s @endverbatim
+ * @details special form that returns a vector
+ * @param[in] v pointer to the first source vector of type #vec3f_t
+ * @param[in] w pointer to the second source vector of type #vec3f_t
+ * @param[in] s scalar value for scaling second vector
+ * @return resulting vector of type #vec3f_t
+ */
+vec3f_t vec3f_madd_v(
+    const vec3f_t* const v,
+    const vec3f_t* const w,
+    const float          s
+);
+
+
+/*!
+ * @brief multiply-and-add of two vectors and two scalars
+ * @verbatim dest = a * v + b * w @endverbatim
+ * @param[out] dest pointer to resulting vector of type #vec3f_t
+ * @param[in] a scalar value for scaling first vector
+ * @param[in] v pointer to the first source vector of type #vec3f_t
+ * @param[in] b scalar value for scaling second vector
+ * @param[in] w pointer to the second source vector of type #vec3f_t
+ * @return none
+ */
+void vec3f_madd2(
+    vec3f_t*             dest,
+    const float          a,
+    const vec3f_t* const v,
+    const float          b,
+    const vec3f_t* const w
+);
+
+
+/*!
+ * @brief multiply-and-add of two vectors and two scalars
+ * @verbatim dest = a * v + b * w @endverbatim
+ * @details special form that returns a vector
+ * @param[in] a scalar value for scaling first vector
+ * @param[in] v pointer to the first source vector of type #vec3f_t
+ * @param[in] b scalar value for scaling second vector
+ * @param[in] w pointer to the second source vector of type #vec3f_t
+ * @return resulting vector of type #vec3f_t
+ */
+vec3f_t vec3f_madd2_v(
+    const float          a,
+    const vec3f_t* const v,
+    const float          b,
+    const vec3f_t* const w
+);
+
+
+/*!
+ * @brief calculate the matrix times vector operation
+ * @verbatim dest = A * v @endverbatim
+ * @details A is a square (3x3) matrix, given by an array of 3 #vec3f_t vectors
+ * @param[out] dest pointer to the resulting vector
+ * @param[in] mat pointer to the "matrix" of type vec3f_t[3]
+ * @param[in] vec pointer to the source vector of type #vec3f_t
+ * @return none
+ */
+void vec3f_matvec(
+    vec3f_t*             dest,
+    const vec3f_t        mat[],
+    const vec3f_t* const vec
+);
+
+
+/*!
+ * @brief calculate the matrix times vector operation
+ * @verbatim dest = A * v @endverbatim
+ * @details A is a square (3x3) matrix, given by an array of 3 #vec3f_t vectors;
+ * special form that return a vector
+ * @param[in] mat pointer to the "matrix" of type vec3f_t[3]
+ * @param[in] vec pointer to the source vector of type #vec3f_t
+ * @return resulting vector of type #vec3f_t
+ */
+vec3f_t vec3f_matvec_v(
+    const vec3f_t        mat[],
+    const vec3f_t* const vec
+);
+
+
+/*!
+ * @brief calculate the outer (cross) product of two vectors
+ * @verbatim dest = v x w @endverbatim
+ * @param[out] dest pointer to the resulting vector of type #vec3f_t
+ * @param[in] v pointer to the first source vector of type #vec3f_t
+ * @param[in] w pointer to the second source vector of type #vec3f_t
+ * @return none
+ */
+void vec3f_outer(
+    vec3f_t*             dest,
+    const vec3f_t* const v,
+    const vec3f_t* const w
+);
+
+
+/*!
+ * @brief calculate the outer (cross) product of two vectors
+ * @verbatim dest = v x w @endverbatim
+ * @details special form that returns a vector
+ * @param[in] v pointer to the first source vector of type #vec3f_t
+ * @param[in] w pointer to the second source vector of type #vec3f_t
+ * @return resulting vector of type #vec3f_t
+ */
+vec3f_t vec3f_outer_v(
+    const vec3f_t* const v,
+    const vec3f_t* const w
+);
+
+
+/*!
+ * @brief scale a given vector to an unit vector (|v| = 1)
+ * @verbatim dest = v / |v| @endverbatim
+ * @details if the length of input vector is "0" no scaling is performed
+ * @param[out] dest pointer to the resulting vector of type #vec3f_t
+ * @param[in] v pointer to the source vector of type #vec3f_t
+ * @return integer, 1 = success, 0 = error
+ */
+int vec3f_scale(
+    vec3f_t*             dest,
+    const vec3f_t* const v
+);
+
+
+/*!
+ * @brief scale a vector to the given length "len" (|v| = len)
+ * @verbatim dest = len * v / |v| @endverbatim
+ * @details if the length of input vector is "0" no scaling is performed
+ * @param[out] dest pointer to the resulting vector of type #vec3f_t
+ * @param[in] v pointer to the source vector of type #vec3f_t
+ * @param[in] len scalar value for the new length
+ * @return integer, 1 = success, 0 = error
+ */
+int vec3f_scale2(
+    vec3f_t*             dest,
+    const vec3f_t* const v,
+    const float          len
+);
+
+
+/*!
+ * @brief multiplication of a vector with a scalar
+ * @verbatim dest = s * v @endverbatim
+ * @param[out] dest pointer to the resulting vector of type #vec3f_t
+ * @param[in] v pointer to the source vector of type #vec3f_t
+ * @param[in] s scalar value for scaling
+ * @return none
+ */
+void vec3f_smul(
+    vec3f_t*             dest,
+    const vec3f_t* const v,
+    const float          s
+);
+
+
+/*!
+ * @brief multiplication of a vector with a scalar
+ * @verbatim dest = s * v @endverbatim
+ * @details special form that returns a vector
+ * @param[in] v pointer to the source vector of type #vec3f_t
+ * @param[in] s scalar value for scaling
+ * @return resulting vector of type #vec3f_t
+ */
+vec3f_t vec3f_smul_v(
+    const vec3f_t* const v,
+    const float          s
+);
+
+
+/*!
+ * @brief calculate the difference of two vectors
+ * @verbatim dest = v - w @endverbatim
+ * @param[out] dest pointer to resulting vector of type #vec3f_t
+ * @param[in] v pointer to first source vector of type #vec3f_t
+ * @param[in] w pointer to second source vector of type #vec3f_t
+ * @return none
+ */
+void vec3f_sub(
+    vec3f_t*             dest,
+    const vec3f_t* const v,
+    const vec3f_t* const w
+);
+
+
+/*!
+ * @brief calculate the difference of two vectors
+ * @verbatim dest = v - w @endverbatim
+ * @details special form that returns a vector
+ * @param[in] v pointer to first source vector of type #vec3f_t
+ * @param[in] w pointer to second source vector of type #vec3f_t
+ * @return resulting vector of type #vec3f_t
+ */
+vec3f_t vec3f_sub_v(
+    const vec3f_t* const v,
+    const vec3f_t* const w
+);
+
+/******************************************************************************/
+
+#endif  /* VEC_3F__H */
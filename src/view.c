@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * @file    view.c
+ * @brief   strided views of caller-owned object data
+ * @author  Bazso Akos
+ * @version 1.0, 16 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include module headers */
+#include "view.h"
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_view_bodies
+ *  DESCRIPTION : set up a view of an array of type body_t
+ *  INPUT       : - pointer "view" of type view_t
+ *                - pointer "obj" to array of type body_t
+ *                - dimension "dim" of array
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coo_view_bodies(
+    view_t*        view,
+    body_t         obj[],
+    const uint32_t dim
+    )
+{
+    /* check input */
+    if ( (view == nullptr) || (obj == nullptr) ) return 1;
+
+    view->dim  = dim;
+    view->x    = COO_COL( obj, body_t, hco.pos.x );
+    view->y    = COO_COL( obj, body_t, hco.pos.y );
+    view->z    = COO_COL( obj, body_t, hco.pos.z );
+    view->vx   = COO_COL( obj, body_t, hco.vel.x );
+    view->vy   = COO_COL( obj, body_t, hco.vel.y );
+    view->vz   = COO_COL( obj, body_t, hco.vel.z );
+    view->sma  = COO_COL( obj, body_t, hel.sma );
+    view->ecc  = COO_COL( obj, body_t, hel.ecc );
+    view->inc  = COO_COL( obj, body_t, hel.inc );
+    view->aph  = COO_COL( obj, body_t, hel.aph );
+    view->lan  = COO_COL( obj, body_t, hel.lan );
+    view->man  = COO_COL( obj, body_t, hel.man );
+    view->mass = COO_COL( obj, body_t, mass );
+
+    return 0;
+} // end coo_view_bodies
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : coo_view_soa
+ *  DESCRIPTION : set up a view of structure-of-arrays storage
+ *  INPUT       : - pointer "view" of type view_t
+ *                - pointer "soa" of type body_soa_t
+ *  OUTPUT      : 0 for success, 1 for error
+ ******************************************************************************/
+int coo_view_soa(
+    view_t*                 view,
+    const body_soa_t* const soa
+    )
+{
+    /* check input */
+    if ( (view == nullptr) || (soa == nullptr) || (soa->x == nullptr) )
+    {
+        return 1;
+    } // end if
+
+    view->dim  = soa->dim;
+    view->x    = (col_t){ soa->x,    sizeof(double) };
+    view->y    = (col_t){ soa->y,    sizeof(double) };
+    view->z    = (col_t){ soa->z,    sizeof(double) };
+    view->vx   = (col_t){ soa->vx,   sizeof(double) };
+    view->vy   = (col_t){ soa->vy,   sizeof(double) };
+    view->vz   = (col_t){ soa->vz,   sizeof(double) };
+    view->sma  = (col_t){ soa->sma,  sizeof(double) };
+    view->ecc  = (col_t){ soa->ecc,  sizeof(double) };
+    view->inc  = (col_t){ soa->inc,  sizeof(double) };
+    view->aph  = (col_t){ soa->aph,  sizeof(double) };
+    view->lan  = (col_t){ soa->lan,  sizeof(double) };
+    view->man  = (col_t){ soa->man,  sizeof(double) };
+    view->mass = (col_t){ soa->mass, sizeof(double) };
+
+    return 0;
+} // end coo_view_soa
+
+/******************************************************************************/
@@ -0,0 +1,262 @@
+/***************************************************************************//**
+ * @file    view.h
+ * @brief   strided views of caller-owned object data
+ * @details accessors for the conversion kernels are defined inline here
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2026 Bazso Akos
+ *
+ * This file is part of libcoocvt.
+ *
+ * libcoocvt is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libcoocvt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libcoocvt.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef COO_VIEW__H
+#define COO_VIEW__H
+
+/******************************************************************************/
+
+/*** include pre-requisite headers ***/
+
+/* include standard headers */
+#include <stdbool.h>
+
+/* include module headers */
+#include "types.h"
+#include "coocvt.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief set up a view of an array of type #body_t
+ * @details the view uses the members hco, hel and mass of \a obj
+ * @param[out] view view of type #view_t
+ * @param[in] obj array of type #body_t
+ * @param[in] dim dimension of array \a obj
+ * @return 0 for success, 1 for error
+ */
+int coo_view_bodies(
+    view_t*        view,
+    body_t         obj[],
+    const uint32_t dim
+);
+
+
+/*!
+ * @brief set up a view of structure-of-arrays storage
+ * @param[out] view view of type #view_t
+ * @param[in] soa storage of type #body_soa_t, see coo_alloc_soa()
+ * @return 0 for success, 1 for error
+ */
+int coo_view_soa(
+    view_t*                 view,
+    const body_soa_t* const soa
+);
+
+
+/*!
+ * @brief coordinate conversion in caller-owned memory
+ * @details convert directly in the columns of \a view using conversion
+ * \a mode, without copying to or from #body_t; failed objects keep their
+ * previous output values; only the modes #CVT_HCO2HEL, #CVT_HEL2HCO and
+ * #CVT_HEL2HCO_POS are available
+ * @param[in,out] ctx conversion context, settings and counters (may be
+ * nullptr for default settings)
+ * @param[in] view view of type #view_t to caller-owned data
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[out] mask status bitmap with COO_MASK_WORDS(view->dim) entries, bit
+ * set for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_view(
+    coo_ctx_t*          ctx,
+    const view_t* const view,
+    const uint32_t      center,
+    CVT_MODE_e          mode,
+    uint64_t            mask[],
+    uint32_t*           nfail
+);
+
+
+/*!
+ * @brief coordinate conversion between caller-owned buffers
+ * @details like coocvt_view(), but reads the input and mass columns of
+ * \a src and writes the output columns of \a dst, so that one snapshot can
+ * be converted to several targets, or converted while other threads read
+ * the old state
+ * @param[in,out] ctx conversion context, settings and counters (may be
+ * nullptr for default settings)
+ * @param[in] dst view of type #view_t for output
+ * @param[in] src view of type #view_t for input, with the same number of
+ * objects as \a dst
+ * @param[in] center index of central body
+ * @param[in] mode specify type of conversion, see enum #CVT_MODE_e
+ * @param[out] mask status bitmap with COO_MASK_WORDS(src->dim) entries, bit
+ * set for each failed object (may be nullptr)
+ * @param[out] nfail number of failed objects (may be nullptr)
+ * @return 0 for success, 1 for error
+ */
+int coocvt_view_oop(
+    coo_ctx_t*          ctx,
+    const view_t* const dst,
+    const view_t* const src,
+    const uint32_t      center,
+    CVT_MODE_e          mode,
+    uint64_t            mask[],
+    uint32_t*           nfail
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+/*** inline function definitions ***/
+
+/*!
+ * @brief address of entry \a i of a column
+ * @param[in] col column of type #col_t
+ * @param[in] i index of entry
+ * @return pointer to entry
+ */
+static inline double* coo_col_at(
+    const col_t    col,
+    const uint32_t i
+    )
+{
+    return( (double*)((char*)col.ptr + (size_t)i * col.stride) );
+} // end coo_col_at
+
+
+/*!
+ * @brief read heliocentric coordinates of object \a i from a view
+ * @param[out] coo coordinates of type #hco_t
+ * @param[in] view view of type #view_t
+ * @param[in] i index of object
+ * @return none
+ */
+static inline void coo_view_get_hco(
+    hco_t*              coo,
+    const view_t* const view,
+    const uint32_t      i
+    )
+{
+    coo->pos.x = *coo_col_at( view->x,  i );
+    coo->pos.y = *coo_col_at( view->y,  i );
+    coo->pos.z = *coo_col_at( view->z,  i );
+    coo->vel.x = *coo_col_at( view->vx, i );
+    coo->vel.y = *coo_col_at( view->vy, i );
+    coo->vel.z = *coo_col_at( view->vz, i );
+} // end coo_view_get_hco
+
+
+/*!
+ * @brief write heliocentric coordinates of object \a i to a view
+ * @param[in] view view of type #view_t
+ * @param[in] i index of object
+ * @param[in] coo coordinates of type #hco_t
+ * @param[in] with_vel whether to write velocities
+ * @return none
+ */
+static inline void coo_view_set_hco(
+    const view_t* const view,
+    const uint32_t      i,
+    const hco_t* const  coo,
+    const bool          with_vel
+    )
+{
+    *coo_col_at( view->x, i ) = coo->pos.x;
+    *coo_col_at( view->y, i ) = coo->pos.y;
+    *coo_col_at( view->z, i ) = coo->pos.z;
+    if ( with_vel )
+    {
+        *coo_col_at( view->vx, i ) = coo->vel.x;
+        *coo_col_at( view->vy, i ) = coo->vel.y;
+        *coo_col_at( view->vz, i ) = coo->vel.z;
+    } // end if
+} // end coo_view_set_hco
+
+
+/*!
+ * @brief read heliocentric elements of object \a i from a view
+ * @param[out] ele elements of type #hel_t
+ * @param[in] view view of type #view_t
+ * @param[in] i index of object
+ * @return none
+ */
+static inline void coo_view_get_hel(
+    hel_t*              ele,
+    const view_t* const view,
+    const uint32_t      i
+    )
+{
+    ele->sma = *coo_col_at( view->sma, i );
+    ele->ecc = *coo_col_at( view->ecc, i );
+    ele->inc = *coo_col_at( view->inc, i );
+    ele->aph = *coo_col_at( view->aph, i );
+    ele->lan = *coo_col_at( view->lan, i );
+    ele->man = *coo_col_at( view->man, i );
+} // end coo_view_get_hel
+
+
+/*!
+ * @brief write heliocentric elements of object \a i to a view
+ * @param[in] view view of type #view_t
+ * @param[in] i index of object
+ * @param[in] ele elements of type #hel_t
+ * @return none
+ */
+static inline void coo_view_set_hel(
+    const view_t* const view,
+    const uint32_t      i,
+    const hel_t* const  ele
+    )
+{
+    *coo_col_at( view->sma, i ) = ele->sma;
+    *coo_col_at( view->ecc, i ) = ele->ecc;
+    *coo_col_at( view->inc, i ) = ele->inc;
+    *coo_col_at( view->aph, i ) = ele->aph;
+    *coo_col_at( view->lan, i ) = ele->lan;
+    *coo_col_at( view->man, i ) = ele->man;
+} // end coo_view_set_hel
+
+
+/*!
+ * @brief mass of object \a i of a view
+ * @param[in] view view of type #view_t
+ * @param[in] i index of object
+ * @return mass
+ */
+static inline double coo_view_mass(
+    const view_t* const view,
+    const uint32_t      i
+    )
+{
+    return( *coo_col_at( view->mass, i ) );
+} // end coo_view_mass
+
+/******************************************************************************/
+
+#endif  /* COO_VIEW__H */